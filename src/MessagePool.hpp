@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_MESSAGEPOOL_HPP
+#define NUCLEAR_MESSAGEPOOL_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "util/FreeList.hpp"
+
+namespace NUClear {
+
+/**
+ * @brief A pool of messages of one type whose memory is reused when the messages are finished with.
+ *
+ * @details
+ *  Messages acquired from the pool are returned to it when the last shared_ptr to them is dropped (e.g. when the
+ *  DataStore and every task holding them have let go). The next acquire reuses a returned message as it is, rather
+ *  than constructing a new one, so buffers inside it (e.g. a std::vector of image data) keep their capacity. This
+ *  means a recycled message still holds the contents it had when it was last used, the caller should overwrite or
+ *  clear what it needs to. Acquired messages are emitted like any other shared_ptr.
+ *  @code
+ *  auto image = MessagePool<Image>::acquire();
+ *  image->data.resize(width * height);
+ *  emit(image);
+ *  @endcode
+ *
+ * @tparam T the type of message in the pool, it must be default constructible
+ */
+template <typename T>
+class MessagePool {
+private:
+    /// @brief Deleted constructor as this class is a static class.
+    MessagePool() = delete;
+    /// @brief Deleted destructor as this class is a static class.
+    ~MessagePool() = delete;
+
+    struct State {
+        /// @brief held while using the list of free messages
+        std::mutex mutex;
+        /// @brief the messages that are waiting to be reused
+        std::vector<std::unique_ptr<T>> free;
+        /// @brief the most messages that will be kept waiting to be reused
+        size_t capacity = 16;
+        /// @brief the number of acquires that reused a message
+        std::atomic<uint64_t> hits{0};
+        /// @brief the number of acquires that had to make a new message
+        std::atomic<uint64_t> misses{0};
+    };
+
+    /// @brief the pool's state, shared with the deleters of messages in flight so it lives as long as they do
+    static const std::shared_ptr<State>& state() {
+        static const std::shared_ptr<State> s = std::make_shared<State>();
+        return s;
+    }
+
+    /// @brief returns messages to the pool when their last reference is dropped
+    struct Recycler {
+        std::shared_ptr<State> pool;
+
+        void operator()(T* message) const {
+            std::unique_ptr<T> m(message);
+            std::lock_guard<std::mutex> lock(pool->mutex);
+            if (pool->free.size() < pool->capacity) { pool->free.push_back(std::move(m)); }
+        }
+    };
+
+public:
+    /**
+     * @brief Gets a message from the pool, or makes a new one if there are none waiting to be reused.
+     *
+     * @return a shared_ptr to the message that returns it to the pool when the last reference to it is dropped
+     */
+    static std::shared_ptr<T> acquire() {
+        const auto& pool = state();
+
+        std::unique_ptr<T> message;
+        {
+            std::lock_guard<std::mutex> lock(pool->mutex);
+            if (!pool->free.empty()) {
+                message = std::move(pool->free.back());
+                pool->free.pop_back();
+            }
+        }
+
+        if (message) { ++pool->hits; }
+        else {
+            ++pool->misses;
+            message = std::make_unique<T>();
+        }
+
+        // The reference count comes from a free list so that a hit does not need the global heap at all
+        return std::shared_ptr<T>(message.release(), Recycler{pool}, util::FreeListAllocator<T>());
+    }
+
+    /**
+     * @brief Sets the most messages that will be kept waiting to be reused, any more than this are deleted.
+     *
+     * @param capacity the most messages to keep
+     */
+    static void set_capacity(size_t capacity) {
+        const auto& pool = state();
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->capacity = capacity;
+        if (pool->free.size() > capacity) { pool->free.resize(capacity); }
+    }
+
+    /**
+     * @brief Gets the number of messages that are waiting to be reused.
+     */
+    static size_t occupancy() {
+        const auto& pool = state();
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        return pool->free.size();
+    }
+
+    /**
+     * @brief Gets the number of acquires that reused a message.
+     */
+    static uint64_t hits() {
+        return state()->hits;
+    }
+
+    /**
+     * @brief Gets the number of acquires that had to make a new message.
+     */
+    static uint64_t misses() {
+        return state()->misses;
+    }
+};
+
+}  // namespace NUClear
+
+#endif  // NUCLEAR_MESSAGEPOOL_HPP
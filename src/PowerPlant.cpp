@@ -18,12 +18,33 @@
 
 #include "PowerPlant.hpp"
 
+#include "threading/SyncGroup.hpp"
 #include "threading/ThreadPoolTask.hpp"
+#include "util/cpu_affinity.hpp"
 
 namespace NUClear {
 
 PowerPlant* PowerPlant::powerplant = nullptr;  // NOLINT
 
+namespace {
+    /**
+     * @brief Wraps a thread's task so that the thread restricts itself to the given cpus before it runs it.
+     *
+     * @param cpus the logical cpus that the thread may run on
+     * @param task the task that the thread will run
+     *
+     * @return the wrapped task
+     */
+    std::function<void()> pin_thread_task(const std::vector<int>& cpus, std::function<void()>&& task) {
+        return [cpus, task] {
+            if (!util::set_current_thread_affinity(cpus)) {
+                PowerPlant::log<WARN>("Unable to set the cpu affinity of a thread, it will run on any cpu");
+            }
+            task();
+        };
+    }
+}  // namespace
+
 PowerPlant::~PowerPlant() {
 
     // Bye bye powerplant
@@ -55,9 +76,28 @@ void PowerPlant::start() {
     // Direct emit startup event
     emit<dsl::word::emit::Direct>(std::make_unique<dsl::word::Startup>());
 
+    // Pin the threads made by add_thread_task if we were asked to
+    if (!configuration.thread_task_affinity.empty()) {
+        for (auto& task : tasks) {
+            task = pin_thread_task(configuration.thread_task_affinity, std::move(task));
+        }
+    }
+
+    // Work out which cpus our pool threads will run on, using one logical cpu from each physical core in auto mode
+    std::vector<std::vector<int>> pool_affinity = configuration.thread_affinity;
+    if (pool_affinity.empty() && configuration.pin_to_physical_cores) {
+        for (const auto& core : util::physical_cores()) {
+            pool_affinity.push_back(std::vector<int>(1, core.front()));
+        }
+    }
+
     // Start all our threads
     for (size_t i = 0; i < configuration.thread_count; ++i) {
-        tasks.push_back(threading::make_thread_pool_task(scheduler));
+        if (pool_affinity.empty()) { tasks.push_back(threading::make_thread_pool_task(scheduler)); }
+        else {
+            tasks.push_back(
+                pin_thread_task(pool_affinity[i % pool_affinity.size()], threading::make_thread_pool_task(scheduler)));
+        }
     }
 
     // Start all our tasks
@@ -65,6 +105,16 @@ void PowerPlant::start() {
         threads.push_back(std::make_unique<std::thread>(task));
     }
 
+    // Start the threads for any separate thread pools that were made before we started
+    /* Mutex Scope */ {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        pools_started = true;
+        for (auto& task : pool_tasks) {
+            pool_threads.push_back(std::make_unique<std::thread>(task));
+        }
+        pool_tasks.clear();
+    }
+
     // Start our main thread using our main task scheduler
     threading::make_thread_pool_task(main_thread_scheduler)();
 
@@ -78,10 +128,98 @@ void PowerPlant::start() {
         catch (const std::system_error&) {
         }
     }
+
+    // Wait for the separate thread pools to finish, keep going until none are left as new pools may be made meanwhile
+    while (true) {
+        std::vector<std::unique_ptr<std::thread>> joining;
+        /* Mutex Scope */ {
+            std::lock_guard<std::mutex> lock(pool_mutex);
+            joining.swap(pool_threads);
+        }
+        if (joining.empty()) { break; }
+
+        for (auto& thread : joining) {
+            try {
+                if (thread->joinable()) { thread->join(); }
+            }
+            catch (const std::system_error&) {
+            }
+        }
+    }
 }
 
 void PowerPlant::submit(std::unique_ptr<threading::ReactionTask>&& task) {
-    scheduler.submit(std::forward<std::unique_ptr<threading::ReactionTask>>(task));
+
+    // If the task's sync group is busy the task waits there, without waking any threads, until the group releases it
+    threading::SyncGroup* group = task->parent.sync_group;
+    if (group != nullptr && !task->admitted && !group->admit(task)) { return; }
+
+    schedule(std::forward<std::unique_ptr<threading::ReactionTask>>(task));
+}
+
+void PowerPlant::schedule(std::unique_ptr<threading::ReactionTask>&& task) {
+
+    // Send the task straight to the thread pool it has to run on
+    if (task->parent.pool != nullptr) {
+        task->parent.pool->submit(std::forward<std::unique_ptr<threading::ReactionTask>>(task));
+    }
+    else if (task->parent.main_thread) {
+        main_thread_scheduler.submit(std::forward<std::unique_ptr<threading::ReactionTask>>(task));
+    }
+    else {
+        scheduler.submit(std::forward<std::unique_ptr<threading::ReactionTask>>(task));
+    }
+}
+
+void PowerPlant::submit_batch(std::vector<std::unique_ptr<threading::ReactionTask>>&& tasks) {
+
+    // Only tasks that go straight to the default thread pool can go in the batch
+    std::vector<std::unique_ptr<threading::ReactionTask>> batch;
+    batch.reserve(tasks.size());
+    for (auto& task : tasks) {
+        const auto& reaction = task->parent;
+        if (reaction.sync_group != nullptr || reaction.pool != nullptr || reaction.main_thread) {
+            submit(std::move(task));
+        }
+        else {
+            batch.push_back(std::move(task));
+        }
+    }
+
+    scheduler.submit(std::move(batch));
+}
+
+threading::TaskScheduler& PowerPlant::get_pool(const std::type_index& type, size_t thread_count) {
+
+    std::lock_guard<std::mutex> lock(pool_mutex);
+
+    auto it = pools.find(type);
+    if (it == pools.end()) {
+        it = pools
+                 .emplace(type,
+                          std::make_unique<threading::TaskScheduler>(thread_count,
+                                                                     configuration.work_stealing,
+                                                                     configuration.spin_count,
+                                                                     configuration.yield_count,
+                                                                     configuration.continuation_slot))
+                 .first;
+        auto& pool = *it->second;
+
+        // A pool made after we shut down never gets any threads
+        if (pools_shutdown) { pool.shutdown(); }
+        else {
+            for (size_t i = 0; i < thread_count; ++i) {
+                if (pools_started) {
+                    pool_threads.push_back(std::make_unique<std::thread>(threading::make_thread_pool_task(pool)));
+                }
+                else {
+                    pool_tasks.push_back(threading::make_thread_pool_task(pool));
+                }
+            }
+        }
+    }
+
+    return *it->second;
 }
 
 void PowerPlant::submit_main(std::unique_ptr<threading::ReactionTask>&& task) {
@@ -103,6 +241,15 @@ void PowerPlant::shutdown() {
     // Shutdown the main threads scheduler
     main_thread_scheduler.shutdown();
 
+    // Shutdown the separate thread pools
+    /* Mutex Scope */ {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        pools_shutdown = true;
+        for (auto& pool : pools) {
+            pool.second->shutdown();
+        }
+    }
+
     // Bye bye powerplant
     powerplant = nullptr;
 }
@@ -36,7 +36,9 @@
 #include "message/LogMessage.hpp"
 #include "threading/TaskScheduler.hpp"
 #include "util/FunctionFusion.hpp"
+#include "util/FreeList.hpp"
 #include "util/demangle.hpp"
+#include "util/is_smart_pointer.hpp"
 #include "util/unpack.hpp"
 
 namespace NUClear {
@@ -61,15 +63,42 @@ public:
      * @brief This class holds the configuration for a PowerPlant.
      *
      * @details
-     *  It configures the number of threads that will be in the PowerPlants thread pool
+     *  It configures the number of threads that will be in the PowerPlants thread pool, how tasks are shared between
+     *  them, how long an idle thread will keep looking for work before it goes to sleep and which cpus the threads are
+     *  allowed to run on. An empty cpu list leaves the thread free to run anywhere.
      */
     struct Configuration {
         /// @brief default to the amount of hardware concurrency (or 2) threads
         Configuration()
-            : thread_count(std::thread::hardware_concurrency() == 0 ? 2 : std::thread::hardware_concurrency()) {}
+            : thread_count(std::thread::hardware_concurrency() == 0 ? 2 : std::thread::hardware_concurrency())
+            , work_stealing(false)
+            , spin_count(0)
+            , yield_count(0)
+            , continuation_slot(false)
+            , thread_affinity()
+            , pin_to_physical_cores(false)
+            , thread_task_affinity()
+            , timer_spin_margin(2.0) {}
 
         /// @brief The number of threads the system will use
         size_t thread_count;
+        /// @brief If each pool thread should have its own task queue and steal tasks from the others when idle
+        bool work_stealing;
+        /// @brief How many times an idle pool thread spins looking for a new task before it starts yielding
+        size_t spin_count;
+        /// @brief How many times an idle pool thread yields looking for a new task before it goes to sleep
+        size_t yield_count;
+        /// @brief If a pool thread should run the first task it submits as soon as it is free, while its data is hot
+        bool continuation_slot;
+        /// @brief The logical cpus each pool thread may run on, pool thread i uses entry i modulo the number of entries
+        std::vector<std::vector<int>> thread_affinity;
+        /// @brief If thread_affinity is empty, pin each pool thread to its own physical core using the cpu topology
+        bool pin_to_physical_cores;
+        /// @brief The logical cpus that threads made by add_thread_task (such as Always reactions) may run on
+        std::vector<int> thread_task_affinity;
+        /// @brief How many deviations of the measured wake-up lateness past its average the chrono controller wakes
+        ///        early by to spin until each timer, more trades cpu time for less jitter and negative never spins
+        double timer_spin_margin;
     };
 
     /// @brief Holds the configuration information for this PowerPlant (such as number of pool threads)
@@ -141,10 +170,36 @@ public:
     /**
      * @brief Submits a new task to the ThreadPool to be queued and then executed.
      *
+     * @details
+     *  The task is sent to the thread pool that its reaction runs on. If the reaction is in a sync group that is
+     *  already running a task, the task is instead parked in that group until the group releases it.
+     *
      * @param task The Reaction task to be executed in the thread pool
      */
     void submit(std::unique_ptr<threading::ReactionTask>&& task);
 
+    /**
+     * @brief Sends a task to the thread pool that its reaction runs on, without going through its sync group.
+     *
+     * @details
+     *  This is used for tasks that have already been admitted by their sync group, such as those it releases.
+     *
+     * @param task The Reaction task to be executed
+     */
+    void schedule(std::unique_ptr<threading::ReactionTask>&& task);
+
+    /**
+     * @brief Submits a group of tasks to the ThreadPool to be queued and then executed in a single operation.
+     *
+     * @details
+     *  The scheduler is only synchronised with once for the whole group, and no more pool threads are woken than are
+     *  needed to run the tasks. Tasks whose reactions are in a sync group, or run on another thread pool, are
+     *  submitted individually instead.
+     *
+     * @param tasks The Reaction tasks to be executed in the thread pool
+     */
+    void submit_batch(std::vector<std::unique_ptr<threading::ReactionTask>>&& tasks);
+
     /**
      * @brief Submits a new task to the main threads thread pool to be queued and then executed.
      *
@@ -152,6 +207,19 @@ public:
      */
     void submit_main(std::unique_ptr<threading::ReactionTask>&& task);
 
+    /**
+     * @brief Gets the TaskScheduler for a separate thread pool, creating the pool if it does not exist yet.
+     *
+     * @details
+     *  The threads for a new pool are started with the PowerPlant, or straight away if it is already running.
+     *
+     * @tparam PoolType The type that describes the pool, its static thread_count member is the number of threads
+     *
+     * @return the scheduler that distributes tasks to the pool's threads
+     */
+    template <typename PoolType>
+    threading::TaskScheduler& get_pool();
+
     /**
      * @brief Log a message through NUClear's system.
      *
@@ -182,6 +250,31 @@ public:
     template <typename T>
     void emit(std::unique_ptr<T>& data);
 
+    /**
+     * @brief Emits data that is already held in a shared_ptr, without allocating it again.
+     *
+     * @details
+     *  This lets messages be forwarded or emitted again, and messages made with make_message or std::make_shared
+     *  only take one allocation for both the data and its reference count. The data must not be modified once it has
+     *  been emitted, as reactions may be reading it on other threads.
+     *
+     * @tparam T    The type of the data that we are emitting (it may be const)
+     *
+     * @param data The data we are emitting
+     */
+    template <typename T>
+    void emit(std::shared_ptr<T> data);
+
+    /**
+     * @brief Emits a value, moving or copying it into a message that is allocated along with its reference count.
+     *
+     * @tparam T    The type of the data that we are emitting
+     *
+     * @param data The data we are emitting
+     */
+    template <typename T, typename = std::enable_if_t<!util::is_smart_pointer<std::decay_t<T>>::value>>
+    void emit(T&& data);
+
     /**
      * @brief Emits data to the system and routes it to the other systems that use it.
      *
@@ -219,6 +312,13 @@ public:
               typename... Arguments>
     void emit(std::unique_ptr<T>& data, Arguments&&... args);
 
+    template <template <typename> class First,
+              template <typename>
+              class... Remainder,
+              typename T,
+              typename... Arguments>
+    void emit(std::shared_ptr<T> data, Arguments&&... args);
+
     template <template <typename> class First, template <typename> class... Remainder, typename... Arguments>
     void emit(Arguments&&... args);
 
@@ -237,6 +337,29 @@ private:
     std::vector<std::function<void()>> startup_tasks;
     /// @brief True if the powerplant is running
     volatile bool is_running = false;
+
+    /**
+     * @brief Gets the TaskScheduler for a separate thread pool, creating the pool if it does not exist yet.
+     *
+     * @param type          the type that identifies the pool
+     * @param thread_count  the number of threads to create the pool with
+     *
+     * @return the scheduler that distributes tasks to the pool's threads
+     */
+    threading::TaskScheduler& get_pool(const std::type_index& type, size_t thread_count);
+
+    /// @brief A mutex to protect the separate thread pools
+    std::mutex pool_mutex;
+    /// @brief The TaskSchedulers for the separate thread pools
+    std::map<std::type_index, std::unique_ptr<threading::TaskScheduler>> pools;
+    /// @brief The thread tasks for the separate thread pools that are waiting for the powerplant to start
+    std::vector<std::function<void()>> pool_tasks;
+    /// @brief The running threads of the separate thread pools
+    std::vector<std::unique_ptr<std::thread>> pool_threads;
+    /// @brief If the separate thread pools have started their threads
+    bool pools_started = false;
+    /// @brief If the separate thread pools have been shut down
+    bool pools_shutdown = false;
 };
 
 // This free floating log function can be called from anywhere and will use the singleton PowerPlant
@@ -245,6 +368,25 @@ void log(Arguments&&... args) {
     PowerPlant::log<level>(std::forward<Arguments>(args)...);
 }
 
+/**
+ * @brief Makes a message to emit, allocating it and its reference count together from a per thread free list.
+ *
+ * @details
+ *  Use this to build a message in place when emitting with a scope, e.g.
+ *  @code emit<Scope::DIRECT>(make_message<Pose>(x, y, theta)); @endcode
+ *
+ * @tparam T         the type of message to make
+ * @tparam Arguments the types of the arguments to construct the message with
+ *
+ * @param args the arguments to construct the message with
+ *
+ * @return a shared_ptr to the new message
+ */
+template <typename T, typename... Arguments>
+std::shared_ptr<T> make_message(Arguments&&... args) {
+    return std::allocate_shared<T>(util::FreeListAllocator<T>(), std::forward<Arguments>(args)...);
+}
+
 }  // namespace NUClear
 
 // Include our Reactor.h first as the tight coupling between powerplant and reactor requires a specific include order
@@ -252,6 +394,7 @@ void log(Arguments&&... args) {
 #include "dsl/word/emit/Direct.hpp"
 #include "dsl/word/emit/Initialise.hpp"
 #include "dsl/word/emit/Local.hpp"
+#include "message/ChronoStatistics.hpp"
 #include "message/CommandLineArguments.hpp"
 #include "message/NetworkConfiguration.hpp"
 #include "message/NetworkEvent.hpp"
@@ -22,7 +22,13 @@
 
 namespace NUClear {
 
-inline PowerPlant::PowerPlant(Configuration config, int argc, const char* argv[]) : configuration(config) {
+inline PowerPlant::PowerPlant(Configuration config, int argc, const char* argv[])
+    : configuration(config)
+    , scheduler(config.thread_count,
+                config.work_stealing,
+                config.spin_count,
+                config.yield_count,
+                config.continuation_slot) {
 
     // Stop people from making more then one powerplant
     if (powerplant != nullptr) {
@@ -72,6 +78,20 @@ void PowerPlant::emit(std::unique_ptr<T>& data) {
     emit<dsl::word::emit::Local>(std::move(data));
 }
 
+// Default emit with no types
+template <typename T>
+void PowerPlant::emit(std::shared_ptr<T> data) {
+
+    emit<dsl::word::emit::Local>(std::move(data));
+}
+
+// Default emit with no types
+template <typename T, typename>
+void PowerPlant::emit(T&& data) {
+
+    emit<dsl::word::emit::Local>(make_message<std::decay_t<T>>(std::forward<T>(data)));
+}
+
 // Default emit with no types
 template <template <typename> class First, template <typename> class... Remainder, typename T, typename... Arguments>
 void PowerPlant::emit(std::unique_ptr<T>& data, Arguments&&... args) {
@@ -140,6 +160,14 @@ void PowerPlant::emit(std::unique_ptr<T>&& data, Arguments&&... args) {
     emit_shared<First, Remainder...>(std::shared_ptr<T>(std::move(data)), std::forward<Arguments>(args)...);
 }
 
+template <template <typename> class First, template <typename> class... Remainder, typename T, typename... Arguments>
+void PowerPlant::emit(std::shared_ptr<T> data, Arguments&&... args) {
+
+    // Messages are never modified once they are emitted, so const data is emitted as its plain type
+    emit_shared<First, Remainder...>(std::const_pointer_cast<std::remove_const_t<T>>(std::move(data)),
+                                     std::forward<Arguments>(args)...);
+}
+
 template <template <typename> class First, template <typename> class... Remainder, typename... Arguments>
 void PowerPlant::emit(Arguments&&... args) {
 
@@ -160,6 +188,11 @@ namespace {
     }
 }  // namespace
 
+template <typename PoolType>
+threading::TaskScheduler& PowerPlant::get_pool() {
+    return get_pool(typeid(PoolType), PoolType::thread_count);
+}
+
 template <enum LogLevel level, typename... Arguments>
 void PowerPlant::log(Arguments&&... args) {
 
@@ -169,7 +202,7 @@ void PowerPlant::log(Arguments&&... args) {
     std::string output = output_stream.str();
 
     auto current_task = threading::ReactionTask::get_current_task();
-    auto task         = current_task ? current_task->stats.get() : nullptr;
+    auto task         = current_task ? &current_task->get_stats() : nullptr;
 
     // Direct emit the log message so that any direct loggers can use it
     powerplant->emit<dsl::word::emit::Direct>(
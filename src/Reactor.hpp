@@ -92,6 +92,20 @@ namespace dsl {
         template <typename>
         struct Sync;
 
+        template <typename>
+        struct Pool;
+
+        template <int, typename>
+        struct Deadline;
+
+        template <int>
+        struct Mailbox;
+
+        struct Coalesce;
+
+        template <size_t, typename, int, typename>
+        struct Batch;
+
         namespace emit {
             template <typename T>
             struct Local;
@@ -234,6 +248,25 @@ protected:
     template <typename SyncGroup>
     using Sync = dsl::word::Sync<SyncGroup>;
 
+    /// @copydoc dsl::word::Pool
+    template <typename PoolType>
+    using Pool = dsl::word::Pool<PoolType>;
+
+    /// @copydoc dsl::word::Deadline
+    template <int ticks, class period = std::chrono::milliseconds>
+    using Deadline = dsl::word::Deadline<ticks, period>;
+
+    /// @copydoc dsl::word::Mailbox
+    template <int capacity>
+    using Mailbox = dsl::word::Mailbox<capacity>;
+
+    /// @copydoc dsl::word::Coalesce
+    using Coalesce = dsl::word::Coalesce;
+
+    /// @copydoc dsl::word::Batch
+    template <size_t n, typename T, int ticks = 0, class period = std::chrono::milliseconds>
+    using Batch = dsl::word::Batch<n, T, ticks, period>;
+
     /// @copydoc dsl::word::Single
     using Single = dsl::word::Single;
 
@@ -284,11 +317,9 @@ public:
         template <typename Function, int... Index>
         auto then(const std::string& label, Function&& callback, const util::Sequence<Index...>&) {
 
-            // Generate the identifer
-            std::vector<std::string> identifier = {label,
-                                                   reactor.reactor_name,
-                                                   util::demangle(typeid(DSL).name()),
-                                                   util::demangle(typeid(Function).name())};
+            // Generate the identifer, the type names are demangled when they are first needed
+            auto identifier = std::make_shared<const threading::ReactionIdentifiers>(
+                label, reactor.reactor_name, typeid(DSL).name(), typeid(Function).name());
 
             // Generate the reaction
             auto reaction = std::make_shared<threading::Reaction>(
@@ -360,7 +391,9 @@ public:
      * @tparam Handlers The handlers for this emit (e.g. LOCAL, NETWORK etc)
      * @tparam T        The type of the data we are emitting, for some handlers (e.g. WATCHDOG) this is optional
      *
-     * @param data The data to emit, for some handlers (e.g. WATCHDOG) this is optional
+     * @param data The data to emit, for some handlers (e.g. WATCHDOG) this is optional. It can be a unique_ptr, a
+     *             shared_ptr (including to const data, e.g. to forward a message) or, when no handlers are given, a
+     *             value. Use make_message to build a message in place when emitting with handlers.
      */
     template <template <typename> class... Handlers, typename T, typename... Arguments>
     void emit(std::unique_ptr<T>&& data, Arguments&&... args) {
@@ -370,6 +403,10 @@ public:
     void emit(std::unique_ptr<T>& data, Arguments&&... args) {
         powerplant.emit<Handlers...>(std::forward<std::unique_ptr<T>>(data), std::forward<Arguments>(args)...);
     }
+    template <template <typename> class... Handlers, typename T, typename... Arguments>
+    void emit(std::shared_ptr<T> data, Arguments&&... args) {
+        powerplant.emit<Handlers...>(std::move(data), std::forward<Arguments>(args)...);
+    }
     template <template <typename> class... Handlers, typename... Arguments>
     void emit(Arguments&&... args) {
         powerplant.emit<Handlers...>(std::forward<Arguments>(args)...);
@@ -399,13 +436,18 @@ public:
 
 // Domain Specific Language
 #include "dsl/word/Always.hpp"
+#include "dsl/word/Batch.hpp"
 #include "dsl/word/Buffer.hpp"
+#include "dsl/word/Coalesce.hpp"
+#include "dsl/word/Deadline.hpp"
 #include "dsl/word/Every.hpp"
 #include "dsl/word/IO.hpp"
 #include "dsl/word/Last.hpp"
+#include "dsl/word/Mailbox.hpp"
 #include "dsl/word/MainThread.hpp"
 #include "dsl/word/Network.hpp"
 #include "dsl/word/Optional.hpp"
+#include "dsl/word/Pool.hpp"
 #include "dsl/word/Priority.hpp"
 #include "dsl/word/Shutdown.hpp"
 #include "dsl/word/Single.hpp"
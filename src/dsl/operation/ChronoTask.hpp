@@ -43,11 +43,13 @@ namespace dsl {
              *              future runs
              * @param time  the time to execute this task
              * @param id    the unique identifer for this task
+             * @param slack how long after its time this task may be run so it can be run along with other tasks
              */
             ChronoTask(std::function<bool(NUClear::clock::time_point&)>&& task,
                        NUClear::clock::time_point time,
-                       uint64_t id)
-                : task(task), time(time), id(id) {}
+                       uint64_t id,
+                       NUClear::clock::duration slack = NUClear::clock::duration::zero())
+                : task(task), time(time), id(id), slack(slack) {}
 
             /**
              * @brief Run the task and return true if the time has been updated to run again
@@ -97,6 +99,9 @@ namespace dsl {
             NUClear::clock::time_point time;
             /// The unique identifier for this task so it can be unbound
             uint64_t id;
+            /// How long after its time this task may be held back so it runs along with other tasks, rather than the
+            /// chrono controller waking up just for it
+            NUClear::clock::duration slack;
         };
 
     }  // namespace operation
@@ -43,19 +43,12 @@ namespace dsl {
 
                 // Our unbinder to remove this reaction
                 reaction->unbinders.push_back([](threading::Reaction& r) {
-                    auto& vec = store::TypeCallbackStore<DataType>::get();
-
-                    auto item = std::find_if(
-                        std::begin(vec), std::end(vec), [&r](const std::shared_ptr<threading::Reaction>& item) {
-                            return item->id == r.id;
-                        });
-
-                    // If the item is in the list erase the item
-                    if (item != std::end(vec)) { vec.erase(item); }
+                    store::TypeCallbackStore<DataType>::remove_if(
+                        [&r](const std::shared_ptr<threading::Reaction>& item) { return item->id == r.id; });
                 });
 
                 // Create our reaction and store it in the TypeCallbackStore
-                store::TypeCallbackStore<DataType>::get().push_back(reaction);
+                store::TypeCallbackStore<DataType>::add(reaction);
             }
         };
 
@@ -68,21 +61,21 @@ namespace dsl {
                 // Set this reaction as no stats emitting
                 reaction->emit_stats = false;
 
+                // Tasks collect statistics from now on as there is somewhere for them to go
+                ++threading::ReactionTask::statistics_subscribers;
+
                 // Our unbinder to remove this reaction
                 reaction->unbinders.push_back([](threading::Reaction& r) {
-                    auto& vec = store::TypeCallbackStore<message::ReactionStatistics>::get();
-
-                    auto item = std::find_if(
-                        std::begin(vec), std::end(vec), [&r](const std::shared_ptr<threading::Reaction>& item) {
-                            return item->id == r.id;
-                        });
-
-                    // If the item is in the list erase the item
-                    if (item != std::end(vec)) { vec.erase(item); }
+                    // If the item was in the list and has been removed, once nothing triggers on statistics tasks can
+                    // stop collecting them
+                    if (store::TypeCallbackStore<message::ReactionStatistics>::remove_if(
+                            [&r](const std::shared_ptr<threading::Reaction>& item) { return item->id == r.id; })) {
+                        --threading::ReactionTask::statistics_subscribers;
+                    }
                 });
 
                 // Create our reaction and store it in the TypeCallbackStore
-                store::TypeCallbackStore<message::ReactionStatistics>::get().push_back(reaction);
+                store::TypeCallbackStore<message::ReactionStatistics>::add(reaction);
             }
         };
 
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_BATCH_HPP
+#define NUCLEAR_DSL_WORD_BATCH_HPP
+
+#include <vector>
+
+#include "../operation/ChronoTask.hpp"
+#include "../operation/TypeBind.hpp"
+#include "../store/ThreadStore.hpp"
+#include "emit/Direct.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief Holds a batch of data, and dereferences to the vector of that data.
+         *
+         * @tparam T the type of data in the batch
+         */
+        template <typename T>
+        struct BatchData {
+            BatchData(std::vector<std::shared_ptr<const T>>&& items) : items(std::move(items)) {}
+
+            const std::vector<std::shared_ptr<const T>>& operator*() const {
+                return items;
+            }
+
+            explicit operator bool() const {
+                return !items.empty();
+            }
+
+            std::vector<std::shared_ptr<const T>> items;
+        };
+
+        /**
+         * @brief
+         *  This is used to collect emitted data into batches, so that a reaction runs once for many emissions.
+         *
+         * @details
+         *  @code on<Batch<n, T>>() @endcode
+         *  @code on<Batch<n, T, ticks, period>>() @endcode
+         *  Each emission of T is added to the reaction's current batch rather than making a task. Once n emissions have
+         *  been collected, a single task is made and read-only access to the batch is provided to the reaction as a
+         *  contiguous std::vector<std::shared_ptr<const T>>, in the order they were emitted.
+         *
+         *  If a timeout is given the batch will also be run once that long has passed since its first emission, even if
+         *  it is not full. Without a timeout a batch only runs once it is full, so the last emissions before shutdown
+         *  may never be seen.
+         *
+         *  Unlike Last, each emission is delivered in exactly one batch.
+         *
+         * @par Implements
+         *  Bind, Get
+         *
+         * @tparam n        the number of emissions in a full batch
+         * @tparam T        the datatype to collect
+         * @tparam ticks    the number of ticks of a particular type to wait for before running a partial batch
+         * @tparam period   a type of duration (e.g. std::chrono::milliseconds) to measure the ticks in
+         */
+        template <size_t n, typename T, int ticks = 0, class period = std::chrono::milliseconds>
+        struct Batch {
+
+            template <typename DSL>
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+
+                // Our timeout waits with the chrono controller, expires the batch and runs the reaction to take it
+                std::function<void(uint64_t)> arm;
+                if (ticks > 0) {
+                    std::weak_ptr<threading::Reaction> weak = reaction;
+                    arm                                     = [weak](uint64_t batch) {
+                        auto reaction = weak.lock();
+                        if (!reaction) { return; }
+
+                        reaction->reactor.emit<emit::Direct>(std::make_unique<operation::ChronoTask>(
+                            [weak, batch](NUClear::clock::time_point&) {
+                                auto reaction = weak.lock();
+                                if (reaction
+                                    && static_cast<threading::TypedBatcher<T>&>(*reaction->batcher).expire(batch)) {
+                                    auto task = reaction->get_task();
+                                    if (task) { reaction->reactor.powerplant.submit(std::move(task)); }
+                                }
+
+                                // We only run once for each batch
+                                return false;
+                            },
+                            NUClear::clock::now() + std::chrono::duration_cast<clock::duration>(period(ticks)),
+                            -1));  // Our ID is -1 as we will remove ourselves
+                    };
+                }
+
+                reaction->batcher = std::make_unique<threading::TypedBatcher<T>>(n, std::move(arm));
+
+                // We are triggered by T like a normal trigger
+                operation::TypeBind<T>::template bind<DSL>(reaction);
+            }
+
+            template <typename DSL>
+            static inline BatchData<T> get(threading::Reaction& r) {
+
+                auto& batcher = static_cast<threading::TypedBatcher<T>&>(*r.batcher);
+                auto data     = store::ThreadStore<std::shared_ptr<T>>::value;
+
+                // If we are running because of an emission add it to the batch, otherwise our timeout has run out
+                return BatchData<T>(data ? batcher.add(std::shared_ptr<const T>(*data)) : batcher.take_expired());
+            }
+        };
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_BATCH_HPP
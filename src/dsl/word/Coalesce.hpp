@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_COALESCE_HPP
+#define NUCLEAR_DSL_WORD_COALESCE_HPP
+
+#include "../../threading/Reaction.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief
+         *  This is used to fold new data into a task of the reaction that is already waiting to run, so that the
+         *  reaction only runs once with the latest data.
+         *
+         * @details
+         *  @code on<Trigger<T, ...>, Coalesce>() @endcode
+         *  While a task of this reaction is waiting to run, new emissions of its data don't make new tasks. When the
+         *  waiting task starts running it binds its data again, so it runs with the latest data that was emitted.
+         *
+         *  This suits reactions that only care about the newest data from a high rate stream, such as displays and
+         *  loggers, as they run at the rate they can keep up with rather than making a task for every emission.
+         *
+         *  As the data is bound again from the global cache, any data that is only available to the emitting thread
+         *  (such as that from a Network or IO event) is not updated.
+         *
+         * @par Implements
+         *  Bind
+         */
+        struct Coalesce {
+
+            template <typename DSL>
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+                reaction->coalescer = std::make_unique<threading::Coalescer>();
+            }
+        };
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_COALESCE_HPP
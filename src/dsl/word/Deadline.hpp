@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_DEADLINE_HPP
+#define NUCLEAR_DSL_WORD_DEADLINE_HPP
+
+#include "../../threading/Reaction.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief
+         *  This is used to give the tasks of a reaction a deadline that they should finish by.
+         *
+         * @details
+         *  @code on<Trigger<T, ...>, Deadline<ticks, period>>() @endcode
+         *  Each task's deadline is the time it was emitted plus the given duration. Within a priority level, tasks
+         *  with a deadline run before tasks without one, earliest deadline first, so that time critical reactions are
+         *  not held up behind housekeeping work. Priority is still considered first, so a more important task without
+         *  a deadline will run before a less important task with one.
+         *
+         *  The deadline of each task, and how many times the reaction has finished after its deadline, are reported
+         *  in its ReactionStatistics.
+         *
+         * @par Implements
+         *  Bind
+         *
+         * @tparam ticks
+         *  the number of ticks of a particular type the task has to finish in
+         * @tparam period
+         *  a type of duration (e.g. std::chrono::milliseconds) to measure the ticks in
+         */
+        template <int ticks, class period = std::chrono::milliseconds>
+        struct Deadline {
+
+            template <typename DSL>
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+                reaction->deadline = std::chrono::duration_cast<clock::duration>(period(ticks));
+            }
+        };
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_DEADLINE_HPP
@@ -22,6 +22,7 @@
 #include <cmath>
 #include "../operation/ChronoTask.hpp"
 #include "../operation/Unbind.hpp"
+#include "../store/ThreadStore.hpp"
 #include "emit/Direct.hpp"
 
 namespace NUClear {
@@ -59,6 +60,12 @@ namespace dsl {
          *  request would be used:
          *  @code on<Every<2, Per<std::chrono::seconds>>() @endcode
          *
+         *  Every reaction runs at whole multiples of its period since the clock's epoch, so reactions whose periods
+         *  divide into each other run at the same moments and are handled together. A reaction with a period that
+         *  doesn't line up with the others can be given some slack, how late it may run so it can be handled along
+         *  with them rather than on its own:
+         *  @code on<Every<15, std::chrono::milliseconds>>(std::chrono::milliseconds(5)) @endcode
+         *
          * @attention
          *  The period which is used to measure the ticks must be greater than or equal to clock::duration or the
          *  program will not compile.
@@ -82,12 +89,20 @@ namespace dsl {
 
             template <typename DSL>
             static inline void bind(const std::shared_ptr<threading::Reaction>& reaction,
-                                    NUClear::clock::duration jump) {
+                                    NUClear::clock::duration jump,
+                                    NUClear::clock::duration slack = NUClear::clock::duration::zero()) {
 
                 reaction->unbinders.push_back([](const threading::Reaction& r) {
                     r.reactor.emit<emit::Direct>(std::make_unique<operation::Unbind<operation::ChronoTask>>(r.id));
                 });
 
+                // Start on the next multiple of our period so we share our times with any commensurate reactions
+                NUClear::clock::time_point now = NUClear::clock::now();
+                NUClear::clock::time_point start =
+                    jump > NUClear::clock::duration::zero()
+                        ? NUClear::clock::time_point((now.time_since_epoch() / jump + 1) * jump)
+                        : now + jump;
+
                 // Send our configuration out
                 reaction->reactor.emit<emit::Direct>(std::make_unique<operation::ChronoTask>(
                     [reaction, jump](NUClear::clock::time_point& time) {
@@ -95,7 +110,11 @@ namespace dsl {
                             // submit the reaction to the thread pool
                             auto task = reaction->get_task();
                             if (task) {
-                                reaction->reactor.powerplant.submit(std::move(task));
+                                // If the chrono controller is collecting tasks to submit together give it ours
+                                auto batch =
+                                    store::ThreadStore<std::vector<std::unique_ptr<threading::ReactionTask>>>::value;
+                                if (batch != nullptr) { batch->push_back(std::move(task)); }
+                                else { reaction->reactor.powerplant.submit(std::move(task)); }
                             }
                         }
                         // If there is an exception while generating a reaction print it here, this shouldn't happen
@@ -112,8 +131,9 @@ namespace dsl {
 
                         return true;
                     },
-                    NUClear::clock::now() + jump,
-                    reaction->id));
+                    start,
+                    reaction->id,
+                    slack));
             }
         };
 
@@ -121,8 +141,9 @@ namespace dsl {
         struct Every {
 
             template <typename DSL>
-            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
-                Every<>::bind<DSL>(reaction, period(ticks));
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction,
+                                    NUClear::clock::duration slack = NUClear::clock::duration::zero()) {
+                Every<>::bind<DSL>(reaction, period(ticks), slack);
             }
         };
 
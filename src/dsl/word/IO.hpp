@@ -19,6 +19,8 @@
 #ifndef NUCLEAR_DSL_WORD_IO_HPP
 #define NUCLEAR_DSL_WORD_IO_HPP
 
+#include <functional>
+
 #include "../../util/platform.hpp"
 #include "../operation/Unbind.hpp"
 #include "../store/ThreadStore.hpp"
@@ -34,6 +36,8 @@ namespace dsl {
             fd_t fd;
             int events;
             std::shared_ptr<threading::Reaction> reaction;
+            /// @brief if set, this is run on the IO thread with the events instead of making a task of the reaction
+            std::function<void(int)> handler;
         };
 
         /**
@@ -94,7 +98,7 @@ namespace dsl {
                     r.reactor.emit<emit::Direct>(std::make_unique<operation::Unbind<IO>>(r.id));
                 });
 
-                auto io_config = std::make_unique<IOConfiguration>(IOConfiguration{fd, watch_set, reaction});
+                auto io_config = std::make_unique<IOConfiguration>(IOConfiguration{fd, watch_set, reaction, nullptr});
 
                 // Send our configuration out
                 reaction->reactor.emit<emit::Direct>(io_config);
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_MAILBOX_HPP
+#define NUCLEAR_DSL_WORD_MAILBOX_HPP
+
+#include "../../threading/Reaction.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief
+         *  This is used to limit how many tasks of a reaction can be waiting to run, and choose what happens to new
+         *  tasks when that limit is reached.
+         *
+         * @details
+         *  @code on<Trigger<T, ...>, Mailbox<n>::DROP_NEWEST>() @endcode
+         *  @code on<Trigger<T, ...>, Mailbox<n>::DROP_OLDEST>() @endcode
+         *  @code on<Trigger<T, ...>, Mailbox<n>::BLOCK<ticks, period>>() @endcode
+         *  Up to n tasks of the reaction can be waiting to run at once. Once a task starts running it no longer counts.
+         *
+         *  With DROP_NEWEST a new task is discarded when the mailbox is full.
+         *
+         *  With DROP_OLDEST the data of the oldest waiting task is discarded to make room for the new data. The waiting
+         *  tasks keep their places in the queue and still run their data in order. This keeps the freshest data for
+         *  streams where stale data is worthless.
+         *
+         *  With BLOCK the emitting thread waits for a task to start running, and if none does before the timeout the
+         *  new task is discarded. Be careful using this from a pool thread as it can't run other tasks while it waits.
+         *
+         *  The number of tasks waiting in the mailbox, and how many have been discarded, are reported in the
+         *  ReactionStatistics of each task.
+         *
+         * @par Implements
+         *  Bind
+         *
+         * @tparam capacity the number of tasks that can be waiting to run at once
+         */
+        template <int capacity>
+        struct Mailbox {
+
+            /// @brief Discard new tasks when the mailbox is full
+            struct DROP_NEWEST {
+                template <typename DSL>
+                static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+                    reaction->mailbox =
+                        std::make_unique<threading::Mailbox>(capacity, threading::Mailbox::DROP_NEWEST);
+                }
+            };
+
+            /// @brief Replace the data of the oldest waiting task when the mailbox is full
+            struct DROP_OLDEST {
+                template <typename DSL>
+                static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+                    reaction->mailbox =
+                        std::make_unique<threading::Mailbox>(capacity, threading::Mailbox::DROP_OLDEST);
+                }
+            };
+
+            /**
+             * @brief Block the emitting thread until there is space in the mailbox, for at most the given time
+             *
+             * @tparam ticks    the number of ticks of a particular type to wait for
+             * @tparam period   a type of duration (e.g. std::chrono::milliseconds) to measure the ticks in
+             */
+            template <int ticks, class period = std::chrono::milliseconds>
+            struct BLOCK {
+                template <typename DSL>
+                static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+                    reaction->mailbox = std::make_unique<threading::Mailbox>(
+                        capacity,
+                        threading::Mailbox::BLOCK,
+                        std::chrono::duration_cast<clock::duration>(period(ticks)));
+                }
+            };
+        };
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_MAILBOX_HPP
@@ -36,17 +36,24 @@ namespace dsl {
          *  For best use, this word should be fused with at least one other binding DSL word.
          *
          * @par Implements
-         *  Pre-condition
+         *  Bind, Reschedule
          */
         struct MainThread {
 
             using task_ptr = std::unique_ptr<threading::ReactionTask>;
 
+            template <typename DSL>
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+
+                // Our tasks are sent to the main thread when they are submitted
+                reaction->main_thread = true;
+            }
+
             template <typename DSL>
             static inline std::unique_ptr<threading::ReactionTask> reschedule(
                 std::unique_ptr<threading::ReactionTask>&& task) {
 
-                // If we are not the main thread, move us to the main thread
+                // If we are not the main thread (such as when run by a direct emit), move us to the main thread
                 if (std::this_thread::get_id() != util::main_thread_id) {
 
                     // Submit to the main thread scheduler
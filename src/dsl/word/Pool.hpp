@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_POOL_HPP
+#define NUCLEAR_DSL_WORD_POOL_HPP
+
+#include "../../threading/Reaction.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief
+         *  This is used to specify that the associated task will execute using the threads of a separate thread pool.
+         *
+         * @details
+         *  @code on<Trigger<T, ...>, Pool<PoolType>>() @endcode
+         *  Tasks for this reaction will only run on the threads of the pool described by PoolType, and will not use
+         *  the default thread pool. This can be used to stop a burst of slow tasks from holding up other reactions.
+         *
+         *  The pool type must declare how many threads the pool has, as a static constexpr thread_count member.
+         *  @code
+         *  struct ImagePool {
+         *      static constexpr int thread_count = 2;
+         *  };
+         *  @endcode
+         *  The pool is created, and its threads started, when the first reaction that uses it is bound. Each pool type has its
+         *  own threads and queue that are shared between all reactions that use it.
+         *
+         *  For best use, this word should be fused with at least one other binding DSL word.
+         *
+         * @par Implements
+         *  Bind, Reschedule
+         *
+         * @tparam PoolType the type that describes the thread pool to use
+         */
+        template <typename PoolType>
+        struct Pool {
+
+            template <typename DSL>
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+
+                // Our tasks are sent to the pool when they are submitted
+                reaction->pool = &reaction->reactor.powerplant.template get_pool<PoolType>();
+            }
+
+            template <typename DSL>
+            static inline std::unique_ptr<threading::ReactionTask> reschedule(
+                std::unique_ptr<threading::ReactionTask>&& task) {
+
+                auto& pool = *task->parent.pool;
+
+                // If we are not one of the pool's threads (such as when run by a direct emit), move us to the pool
+                if (!pool.is_current()) {
+
+                    // Submit to the pool's scheduler
+                    pool.submit(std::move(task));
+
+                    // We took the task away so return null
+                    return std::unique_ptr<threading::ReactionTask>(nullptr);
+                }
+                // Otherwise run!
+                else {
+                    return std::move(task);
+                }
+            }
+        };
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_POOL_HPP
@@ -19,6 +19,8 @@
 #ifndef NUCLEAR_DSL_WORD_SYNC_HPP
 #define NUCLEAR_DSL_WORD_SYNC_HPP
 
+#include "../../threading/SyncGroup.hpp"
+
 namespace NUClear {
 namespace dsl {
     namespace word {
@@ -32,10 +34,10 @@ namespace dsl {
          *  When a group of tasks has been synchronised, only one task from the group will execute at a given time.
          *
          *  Should another task from this group be scheduled/requested (during execution of the current task), it will
-         *  be sidelined into a priority queue.
+         *  be sidelined into a priority queue when it is submitted, without waking any threads.
          *
-         *  Upon completion of the currently executing task, the queue will be polled to allow execution of the next
-         *  task in this group.
+         *  Upon completion of the currently executing task, the next task in this group's queue will be handed
+         *  directly to the thread pool.
          *
          *  Tasks in the synchronization queue are ordered based on their priority level, then their emission timestamp.
          *
@@ -52,7 +54,7 @@ namespace dsl {
          *  NUClear will have task and thread control so that system resources can be efficiently managed.
          *
          * @par Implements
-         *  Pre-condition, Post-condition
+         *  Bind, Reschedule, Post-condition
          *
          * @tparam SyncGroup
          *  the type/group to synchronize on.  This needs to be a declared type within the system.  It is common to
@@ -63,62 +65,38 @@ namespace dsl {
         template <typename SyncGroup>
         struct Sync {
 
-            using task_ptr = std::unique_ptr<threading::ReactionTask>;
+            /// @brief the group that admits one task at a time
+            static threading::SyncGroup group;
+
+            template <typename DSL>
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
 
-            /// @brief our queue which sorts tasks by priority
-            static std::priority_queue<task_ptr> queue;
-            /// @brief how many tasks are currently running
-            static volatile bool running;
-            /// @brief a mutex to ensure data consistency
-            static std::mutex mutex;
+                // Let the scheduler know which group our tasks belong to so it can park them when they are submitted
+                reaction->sync_group = &group;
+            }
 
             template <typename DSL>
             static inline std::unique_ptr<threading::ReactionTask> reschedule(
                 std::unique_ptr<threading::ReactionTask>&& task) {
 
-                // Lock our mutex
-                std::lock_guard<std::mutex> lock(mutex);
+                // Tasks that were run without being submitted (such as direct emits) still need to be admitted here
+                if (task->admitted || group.admit(task)) { return std::move(task); }
 
-                // If we are already running then queue, otherwise return and set running
-                if (running) {
-                    queue.push(std::move(task));
-                    return std::unique_ptr<threading::ReactionTask>(nullptr);
-                }
-                else {
-                    running = true;
-                    return std::move(task);
-                }
+                // We were parked in the group so return null
+                return std::unique_ptr<threading::ReactionTask>(nullptr);
             }
 
             template <typename DSL>
             static void postcondition(threading::ReactionTask& task) {
 
-                // Lock our mutex
-                std::lock_guard<std::mutex> lock(mutex);
-
-                // We are finished running
-                running = false;
-
-                // If we have another task, add it
-                if (!queue.empty()) {
-                    std::unique_ptr<threading::ReactionTask> next_task(
-                        std::move(const_cast<std::unique_ptr<threading::ReactionTask>&>(queue.top())));
-                    queue.pop();
-
-                    // Resubmit this task to the reaction queue
-                    task.parent.reactor.powerplant.submit(std::move(next_task));
-                }
+                // Hand the group directly to the next task that is waiting, and schedule it
+                auto next_task = group.release();
+                if (next_task) { task.parent.reactor.powerplant.schedule(std::move(next_task)); }
             }
         };
 
         template <typename SyncGroup>
-        std::priority_queue<typename Sync<SyncGroup>::task_ptr> Sync<SyncGroup>::queue;
-
-        template <typename SyncGroup>
-        volatile bool Sync<SyncGroup>::running = false;
-
-        template <typename SyncGroup>
-        std::mutex Sync<SyncGroup>::mutex;
+        threading::SyncGroup Sync<SyncGroup>::group;
 
     }  // namespace word
 }  // namespace dsl
@@ -124,7 +124,8 @@ namespace dsl {
                 });
                 reaction->unbinders.push_back([cfd](const threading::Reaction&) { close(cfd); });
 
-                auto io_config = std::make_unique<IOConfiguration>(IOConfiguration{fd.release(), IO::READ, reaction});
+                auto io_config =
+                    std::make_unique<IOConfiguration>(IOConfiguration{fd.release(), IO::READ, reaction, nullptr});
 
                 // Send our configuration out
                 reaction->reactor.emit<emit::Direct>(io_config);
@@ -148,8 +148,8 @@ namespace dsl {
                 });
                 reaction->unbinders.push_back([cfd](const threading::Reaction&) { close(cfd); });
 
-                auto io_config =
-                    std::make_unique<IOConfiguration>(IOConfiguration{fd.release(), IO::READ, std::move(reaction)});
+                auto io_config = std::make_unique<IOConfiguration>(
+                    IOConfiguration{fd.release(), IO::READ, std::move(reaction), nullptr});
 
                 // Send our configuration out
                 reaction->reactor.emit<emit::Direct>(io_config);
@@ -302,8 +302,8 @@ namespace dsl {
                     });
                     reaction->unbinders.push_back([cfd](const threading::Reaction&) { close(cfd); });
 
-                    auto io_config =
-                        std::make_unique<IOConfiguration>(IOConfiguration{fd.release(), IO::READ, std::move(reaction)});
+                    auto io_config = std::make_unique<IOConfiguration>(
+                        IOConfiguration{fd.release(), IO::READ, std::move(reaction), nullptr});
 
                     // Send our configuration out
                     reaction->reactor.emit<emit::Direct>(io_config);
@@ -402,8 +402,8 @@ namespace dsl {
                     });
                     reaction->unbinders.push_back([cfd](const threading::Reaction&) { close(cfd); });
 
-                    auto io_config =
-                        std::make_unique<IOConfiguration>(IOConfiguration{fd.release(), IO::READ, std::move(reaction)});
+                    auto io_config = std::make_unique<IOConfiguration>(
+                        IOConfiguration{fd.release(), IO::READ, std::move(reaction), nullptr});
 
                     // Send our configuration out for each file descriptor (same reaction)
                     reaction->reactor.emit<emit::Direct>(io_config);
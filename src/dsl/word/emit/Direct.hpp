@@ -19,6 +19,8 @@
 #ifndef NUCLEAR_DSL_WORD_EMIT_DIRECT_HPP
 #define NUCLEAR_DSL_WORD_EMIT_DIRECT_HPP
 
+#include <vector>
+
 #include "../../../PowerPlant.hpp"
 #include "../../store/DataStore.hpp"
 #include "../../store/ThreadStore.hpp"
@@ -54,8 +56,19 @@ namespace dsl {
 
                 static void emit(PowerPlant& powerplant, std::shared_ptr<DataType> data) {
 
+                    // Set the data into the global store first, so tasks this data is coalesced into can find it
+                    store::DataStore<DataType>::set(data);
+
+                    // Take our own copy of the reactions that are interested, as we run them inline we can't hold the
+                    // snapshot while they run or nothing retired while they run could be reclaimed
+                    std::vector<std::shared_ptr<threading::Reaction>> reactions;
+                    {
+                        auto snapshot = store::TypeCallbackStore<DataType>::get();
+                        reactions.assign(snapshot.begin(), snapshot.end());
+                    }
+
                     // Run all our reactions that are interested
-                    for (auto& reaction : store::TypeCallbackStore<DataType>::get()) {
+                    for (auto& reaction : reactions) {
                         try {
 
                             // Set our thread local store data each time (as during direct it can be overwritten)
@@ -78,9 +91,6 @@ namespace dsl {
 
                     // Unset our thread local store data
                     store::ThreadStore<std::shared_ptr<DataType>>::value = nullptr;
-
-                    // Set the data into the global store
-                    store::DataStore<DataType>::set(data);
                 }
             };
 
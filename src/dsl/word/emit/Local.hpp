@@ -51,14 +51,18 @@ namespace dsl {
 
                 static void emit(PowerPlant& powerplant, std::shared_ptr<DataType> data) {
 
+                    // Set the data into the global store first, so tasks this data is coalesced into can find it
+                    store::DataStore<DataType>::set(data);
+
                     // Set our thread local store data
                     store::ThreadStore<std::shared_ptr<DataType>>::value = &data;
 
-                    // Run all our reactions that are interested
+                    // Collect the tasks from all our reactions that are interested so they can be submitted together
+                    std::vector<std::unique_ptr<threading::ReactionTask>> tasks;
                     for (auto& reaction : store::TypeCallbackStore<DataType>::get()) {
                         try {
                             auto task = reaction->get_task();
-                            if (task) { powerplant.submit(std::move(task)); }
+                            if (task) { tasks.push_back(std::move(task)); }
                         }
                         // If there is an exception while generating a reaction print it here, this shouldn't happen
                         catch (const std::exception& ex) {
@@ -74,8 +78,8 @@ namespace dsl {
                     // Unset our thread local store data
                     store::ThreadStore<std::shared_ptr<DataType>>::value = nullptr;
 
-                    // Set the data into the global store
-                    store::DataStore<DataType>::set(data);
+                    // Submit all of the tasks at once
+                    if (!tasks.empty()) { powerplant.submit_batch(std::move(tasks)); }
                 }
             };
 
@@ -19,27 +19,71 @@
 #ifndef NUCLEAR_EXTENSION_CHRONOCONTROLLER
 #define NUCLEAR_EXTENSION_CHRONOCONTROLLER
 
+#if defined(__linux__)
+#    include <sys/timerfd.h>
+#    include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
 #include "../PowerPlant.hpp"
 #include "../Reactor.hpp"
+#include "../dsl/store/ThreadStore.hpp"
+#include "../message/ChronoStatistics.hpp"
+#include "../util/FileDescriptor.hpp"
+#include "../util/update_current_thread_priority.hpp"
 
 namespace NUClear {
 namespace extension {
 
+    /**
+     * @brief Runs chrono tasks at the times they ask for.
+     *
+     * @details
+     *  On Linux the controller doesn't have a thread of its own. It arms a timerfd for the next task, and the IO
+     *  controller's thread runs the tasks when it becomes readable, so timers and IO share one event loop. On other
+     *  platforms an Always reaction waits on a condition variable for the next task.
+     */
     class ChronoController : public Reactor {
     private:
         using ChronoTask = NUClear::dsl::operation::ChronoTask;
 
     public:
         explicit ChronoController(std::unique_ptr<NUClear::Environment> environment)
-            : Reactor(std::move(environment)), wait_offset(std::chrono::milliseconds(0)) {
+            : Reactor(std::move(environment))
+            , max_slack(NUClear::clock::duration::zero())
+            , running(false)
+            , wait_offset(std::chrono::milliseconds(0))
+            , wake_lateness(0)
+            , wake_deviation(0)
+            , stats()
+            , stats_start(NUClear::clock::now())
+            , lateness_sum()
+#if defined(__linux__)
+            , timer(timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC))
+            , armed(NUClear::clock::time_point::max())
+#endif
+        {
 
             on<Trigger<ChronoTask>>().then("Add Chrono task", [this](std::shared_ptr<const ChronoTask> task) {
                 // Lock the mutex while we're doing stuff
                 {
                     std::lock_guard<std::mutex> lock(mutex);
 
-                    // Add our new task to the heap
-                    tasks.push_back(*task);
+                    // Add our new task to the schedule
+                    auto it = schedule(ChronoTask(*task));
+
+#if defined(__linux__)
+                    // If this is now our soonest task, our timer needs to go off sooner
+                    if (it == tasks.begin()) { arm(); }
+#else
+                    (void) it;
+#endif
                 }
 
                 // Poke the system
@@ -52,22 +96,66 @@ namespace extension {
                     {
                         std::lock_guard<std::mutex> lock(mutex);
 
-                        // Find the task
-                        auto it = std::find_if(
-                            tasks.begin(), tasks.end(), [&](const ChronoTask& task) { return task.id == unbind.id; });
-
-                        // Remove if if it exists
-                        if (it != tasks.end()) {
-                            tasks.erase(it);
+                        // Find the tasks with this id and remove them if they exist
+                        auto range = ids.equal_range(unbind.id);
+                        for (auto it = range.first; it != range.second; ++it) {
+                            tasks.erase(it->second);
                         }
+                        ids.erase(range.first, range.second);
+
+                        // If its tasks are running right now they must not be put back in the schedule
+                        if (running) { cancelled.push_back(unbind.id); }
                     }
 
                     // Poke the system to make sure it's not waiting on something that's gone
                     wait.notify_all();
                 });
 
+#if defined(__linux__)
+            if (timer.fd < 0) {
+                throw std::system_error(errno, std::system_category(), "We were unable to make the chrono timer");
+            }
+
+            // Have the IO controller run our tasks on its thread when our timer goes off, it is installed after us so
+            // we wait until startup to tell it
+            auto io_config     = std::make_unique<dsl::word::IOConfiguration>();
+            io_config->fd      = timer.fd;
+            io_config->events  = IO::READ;
+            io_config->handler = [this](int) {
+                // Clear our timer so it isn't readable until it goes off again
+                uint64_t expirations;
+                if (read(timer.fd, &expirations, sizeof(expirations)) < 0 && errno != EAGAIN) {
+                    throw std::system_error(errno, std::system_category(), "There was an error reading our timer");
+                }
+
+                std::unique_lock<std::mutex> lock(mutex);
+
+                // Learn how late we were woken up so we can wake up earlier next time
+                NUClear::clock::time_point now = NUClear::clock::now();
+                if (now >= armed) { measure(now - armed); }
+
+                // Run our tasks if it's nearly time, otherwise our timer went off early or our tasks have changed
+                if (!tasks.empty() && now + wait_offset > tasks.begin()->first) {
+                    // Dispatch at the priority the chrono thread had so the tasks we submit can't preempt us part way
+                    // through, the IO controller's next task puts the thread back to its own priority
+                    update_current_thread_priority(dsl::word::Priority::REALTIME::value);
+                    run(lock);
+                }
+
+                // Set our timer for the next task
+                if (!lock.owns_lock()) { lock.lock(); }
+                arm();
+            };
+            emit<Scope::INITIALIZE>(io_config);
+#else
             // When we shutdown we notify so we quit now
-            on<Shutdown>().then("Shutdown Chrono Controller", [this] { wait.notify_all(); });
+            on<Shutdown>().then("Shutdown Chrono Controller", [this] {
+                // Take the lock so we can't notify between the controller checking if we are running and waiting
+                /* Mutex Scope */ {
+                    std::lock_guard<std::mutex> lock(mutex);
+                }
+                wait.notify_all();
+            });
 
             on<Always, Priority::REALTIME>().then("Chrono Controller", [this] {
                 // Acquire the mutex lock so we can wait on it
@@ -76,54 +164,247 @@ namespace extension {
                 // If we have tasks to do
                 if (!tasks.empty()) {
 
-                    // Make the list into a heap so we can remove the soonest ones
-                    std::make_heap(tasks.begin(), tasks.end(), std::greater<>());
+                    // If we are within the wait offset of the time, run our tasks
+                    if (NUClear::clock::now() + wait_offset > tasks.begin()->first) { run(lock); }
+                    // Otherwise we wait for the next event using a wait_until (waking up early by how late the
+                    // operating system usually wakes us) Either that or until we get interrupted with a new event
+                    else {
+                        NUClear::clock::time_point wake = tasks.begin()->first - wait_offset;
+                        if (wait.wait_until(lock, wake) == std::cv_status::timeout) {
+                            measure(NUClear::clock::now() - wake);
+                        }
+                    }
+                }
+                // Otherwise we wait for something to happen, unless we are shutting down as nothing will
+                else if (powerplant.running()) {
+                    wait.wait(lock);
+                }
+            });
+#endif
+        }
 
-                    // If we are within the wait offset of the time, spinlock until we get there for greater
-                    // accuracy
-                    if (NUClear::clock::now() + wait_offset > tasks.front().time) {
+    private:
+        using Schedule = std::multimap<NUClear::clock::time_point, ChronoTask>;
 
-                        // Spinlock!
-                        while (NUClear::clock::now() < tasks.front().time) {
-                        }
+        /**
+         * @brief Spins until the soonest task's time, then runs all the tasks that are due.
+         *
+         * @details Must be called with the mutex held, which may have been released when this returns.
+         *
+         * @param lock the lock holding our mutex
+         */
+        void run(std::unique_lock<std::mutex>& lock) {
 
-                        NUClear::clock::time_point now = NUClear::clock::now();
+            // Tasks that must run before we could sleep and be woken again for them run together with the soonest one
+            const NUClear::clock::time_point soonest = tasks.begin()->first;
+            NUClear::clock::time_point target        = soonest;
+            for (auto it = tasks.begin(); it != tasks.end() && it->first < soonest + wait_offset; ++it) {
+                target = it->first;
+            }
 
-                        // Move back from the end poping the heap
-                        for (auto end = tasks.end(); end != tasks.begin() && tasks.front().time < now;) {
-                            // Run our task and if it returns false remove it
-                            bool renew = tasks.front()();
+            // Spinlock! We don't need the lock for this and the wait offset should keep it short
+            lock.unlock();
+            NUClear::clock::time_point spin_start = NUClear::clock::now();
+            while (NUClear::clock::now() < target) {
+            }
+            NUClear::clock::time_point now = NUClear::clock::now();
+            lock.lock();
 
-                            // Move this to the back of the list
-                            std::pop_heap(tasks.begin(), end, std::greater<>());
+            stats.spin_time += now - spin_start;
 
-                            if (!renew) {
-                                end = tasks.erase(--end);
-                            }
-                            else {
-                                --end;
-                            }
-                        }
-                    }
-                    // Otherwise we wait for the next event using a wait_for (with a small offset for greater
-                    // accuracy) Either that or until we get interrupted with a new event
-                    else {
-                        wait.wait_until(lock, tasks.front().time - wait_offset);
-                    }
+            // Take all the tasks that must run now out of the schedule, along with any that have slack and are already
+            // due, so they run with these rather than us waking up again for them
+            std::vector<ChronoTask> due;
+            for (auto it = tasks.begin(); it != tasks.end() && it->first <= now + max_slack;) {
+                if (it->first <= now || it->second.time <= now) {
+
+                    // Track how late we are running this task
+                    NUClear::clock::duration lateness = now - it->second.time;
+                    lateness_sum += lateness;
+                    stats.max_lateness = std::max(stats.max_lateness, lateness);
+                    ++stats.dispatched;
+
+                    unindex(it);
+                    due.push_back(std::move(it->second));
+                    it = tasks.erase(it);
                 }
-                // Otherwise we wait for something to happen
                 else {
-                    wait.wait(lock);
+                    ++it;
                 }
-            });
+            }
+            ++stats.wakeups;
+
+            // Run them without the lock so they can add and unbind chrono tasks themselves
+            running = true;
+            lock.unlock();
+
+            // Reactions our tasks make are collected so they can be submitted together
+            std::vector<std::unique_ptr<threading::ReactionTask>> batch;
+            dsl::store::ThreadStore<std::vector<std::unique_ptr<threading::ReactionTask>>>::value = &batch;
+
+            std::vector<ChronoTask> renewed;
+            for (auto& task : due) {
+                // Run our task and if it returns true it wants to run again at its new time
+                if (task()) { renewed.push_back(std::move(task)); }
+            }
+
+            dsl::store::ThreadStore<std::vector<std::unique_ptr<threading::ReactionTask>>>::value = nullptr;
+            if (!batch.empty()) { powerplant.submit_batch(std::move(batch)); }
+
+            lock.lock();
+            running = false;
+
+            // Put the renewed tasks back unless they were unbound while they were running
+            for (auto& task : renewed) {
+                if (std::find(cancelled.begin(), cancelled.end(), task.id) == cancelled.end()) {
+                    schedule(std::move(task));
+                }
+            }
+            cancelled.clear();
+
+            // Once our statistics cover long enough send them out and start again
+            if (now - stats_start >= std::chrono::seconds(1)) {
+                auto msg            = std::make_unique<message::ChronoStatistics>(stats);
+                msg->period         = now - stats_start;
+                msg->wake_lateness  = NUClear::clock::duration(std::llround(wake_lateness));
+                msg->wake_deviation = NUClear::clock::duration(std::llround(wake_deviation));
+                msg->wake_offset    = wait_offset;
+                msg->mean_lateness  = stats.dispatched > 0
+                                         ? lateness_sum / NUClear::clock::duration::rep(stats.dispatched)
+                                         : NUClear::clock::duration::zero();
+
+                stats        = message::ChronoStatistics();
+                stats_start  = now;
+                lateness_sum = NUClear::clock::duration();
+
+                lock.unlock();
+                emit(std::move(msg));
+            }
         }
 
-    private:
-        std::vector<dsl::operation::ChronoTask> tasks;
+        /**
+         * @brief Updates our estimate of how late the operating system wakes us up, and how early we should wake.
+         *
+         * @details Must be called with the mutex held.
+         *
+         * @param lateness how long after the time we asked for we were woken up
+         */
+        void measure(const NUClear::clock::duration& lateness) {
+
+            // Cap each sample so a single long stall can't leave us spinning for a long time afterwards
+            double late = double(std::min(std::max(lateness, NUClear::clock::duration::zero()),
+                                          NUClear::clock::duration(std::chrono::milliseconds(1)))
+                                     .count());
+
+            // Exponentially weighted moving averages of our lateness and how much it deviates
+            wake_lateness += (late - wake_lateness) / 16.0;
+            wake_deviation += (std::abs(late - wake_lateness) - wake_deviation) / 16.0;
+
+            double margin = powerplant.configuration.timer_spin_margin;
+            wait_offset   = margin < 0 ? NUClear::clock::duration::zero()
+                                     : NUClear::clock::duration(std::llround(wake_lateness + margin * wake_deviation));
+        }
+
+#if defined(__linux__)
+        /**
+         * @brief Sets our timer to go off the wait offset before our soonest task, or stops it if we have none.
+         *
+         * @details Must be called with the mutex held.
+         */
+        void arm() {
+            itimerspec spec{};
+
+            if (tasks.empty()) { armed = NUClear::clock::time_point::max(); }
+            else {
+                armed = tasks.begin()->first - wait_offset;
+
+                // The timer is set relative to now as our clock may not be the timer's clock, and a zero time would
+                // stop the timer rather than have it go off straight away
+                auto delay = std::max(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(armed - NUClear::clock::now()),
+                    std::chrono::nanoseconds(1));
+                spec.it_value.tv_sec  = std::chrono::duration_cast<std::chrono::seconds>(delay).count();
+                spec.it_value.tv_nsec = (delay % std::chrono::seconds(1)).count();
+            }
+
+            if (timerfd_settime(timer.fd, 0, &spec, nullptr) < 0) {
+                throw std::system_error(errno, std::system_category(), "We were unable to set the chrono timer");
+            }
+        }
+#endif
+
+        /**
+         * @brief Adds a task to the schedule, and to the index of ids if it can be unbound.
+         *
+         * @details Must be called with the mutex held.
+         *
+         * @param task the task to add
+         *
+         * @return where the task is in the schedule
+         */
+        Schedule::iterator schedule(ChronoTask&& task) {
+            uint64_t id = task.id;
+            max_slack   = std::max(max_slack, task.slack);
+
+            // Tasks are kept in order of the latest they can run, which is when we have to wake up for them
+            auto it = tasks.emplace(task.time + task.slack, std::move(task));
+
+            // Tasks with an id of -1 remove themselves so they are never unbound
+            if (id != uint64_t(-1)) { ids.emplace(id, it); }
+
+            return it;
+        }
+
+        /**
+         * @brief Removes a task from the index of ids before it is taken out of the schedule.
+         *
+         * @details Must be called with the mutex held.
+         *
+         * @param it the task in the schedule
+         */
+        void unindex(Schedule::iterator it) {
+            auto range = ids.equal_range(it->second.id);
+            for (auto i = range.first; i != range.second; ++i) {
+                if (i->second == it) {
+                    ids.erase(i);
+                    return;
+                }
+            }
+        }
+
+        /// @brief the tasks ordered by the latest time they can next run, tasks at the same time run in the order added
+        Schedule tasks;
+        /// @brief the most slack any task has been given, so we know how far into the schedule due tasks can be
+        NUClear::clock::duration max_slack;
+        /// @brief the tasks in the schedule indexed by their id so they can be unbound without a search
+        std::unordered_multimap<uint64_t, Schedule::iterator> ids;
+        /// @brief if tasks have been taken out of the schedule and are running without the lock
+        bool running;
+        /// @brief the ids unbound while tasks were running, whose running tasks must not be renewed
+        std::vector<uint64_t> cancelled;
         std::mutex mutex;
         std::condition_variable wait;
 
+        /// @brief how far before a task's time we wake up to spin until it
         NUClear::clock::duration wait_offset;
+        /// @brief the average time the operating system wakes us after the time we asked for, in clock ticks
+        double wake_lateness;
+        /// @brief the average deviation of our wake up lateness from its average, in clock ticks
+        double wake_deviation;
+
+        /// @brief the statistics we are collecting to send out
+        message::ChronoStatistics stats;
+        /// @brief when we started collecting the current statistics
+        NUClear::clock::time_point stats_start;
+        /// @brief the total lateness of the tasks we have run for the current statistics
+        NUClear::clock::duration lateness_sum;
+
+#if defined(__linux__)
+        /// @brief the timer that goes off when our soonest task is due
+        util::FileDescriptor timer;
+        /// @brief the time our timer is set to go off at
+        NUClear::clock::time_point armed;
+#endif
     };
 
 }  // namespace extension
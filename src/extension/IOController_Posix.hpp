@@ -23,6 +23,7 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <functional>
 #include <mutex>
 #include <system_error>
 
@@ -36,13 +37,17 @@ namespace extension {
     class IOController : public Reactor {
     private:
         struct Task {
-            Task() : fd(), events(0), reaction() {}
-            Task(const fd_t& fd, short events, const std::shared_ptr<threading::Reaction>& reaction)
-                : fd(fd), events(events), reaction(reaction) {}
+            Task() : fd(), events(0), reaction(), handler() {}
+            Task(const fd_t& fd,
+                 short events,
+                 const std::shared_ptr<threading::Reaction>& reaction,
+                 const std::function<void(int)>& handler = std::function<void(int)>())
+                : fd(fd), events(events), reaction(reaction), handler(handler) {}
 
             fd_t fd;
             short events;
             std::shared_ptr<threading::Reaction> reaction;
+            std::function<void(int)> handler;
 
             bool operator<(const Task& other) const {
                 return fd == other.fd ? events < other.events : fd < other.fd;
@@ -72,7 +77,8 @@ namespace extension {
                     // Lock our mutex to avoid concurrent modification
                     std::lock_guard<std::mutex> lock(reaction_mutex);
 
-                    reactions.emplace_back(config.fd, static_cast<short>(config.events), config.reaction);
+                    reactions.emplace_back(
+                        config.fd, static_cast<short>(config.events), config.reaction, config.handler);
 
                     // Resort our list
                     std::sort(std::begin(reactions), std::end(reactions));
@@ -95,7 +101,7 @@ namespace extension {
 
                     // Find our reaction
                     auto reaction = std::find_if(std::begin(reactions), std::end(reactions), [&unbind](const Task& t) {
-                        return t.reaction->id == unbind.id;
+                        return t.reaction && t.reaction->id == unbind.id;
                     });
 
                     if (reaction != std::end(reactions)) { reactions.erase(reaction); }
@@ -183,8 +189,12 @@ namespace extension {
                                         // Loop through our values
                                         for (auto it = range.first; it != range.second; ++it) {
 
+                                            // Handlers run here on our thread, such as the chrono controller's
+                                            if (it->handler && (it->events & fd.revents) != 0) {
+                                                it->handler(fd.revents);
+                                            }
                                             // We should emit if the reaction is interested
-                                            if ((it->events & fd.revents) != 0) {
+                                            else if ((it->events & fd.revents) != 0) {
 
                                                 // Make our event to pass through
                                                 IO::Event e;
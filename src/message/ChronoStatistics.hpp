@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_MESSAGE_CHRONOSTATISTICS_HPP
+#define NUCLEAR_MESSAGE_CHRONOSTATISTICS_HPP
+
+#include <cstdint>
+
+#include "../clock.hpp"
+
+namespace NUClear {
+namespace message {
+
+    /**
+     * @brief Holds details about how accurately the chrono controller has been running its timers.
+     *
+     * @details
+     *  These are emitted by the chrono controller about once a second while it has timers to run. The wake-up
+     *  lateness is how long after the requested time the operating system woke the controller up, which the
+     *  controller measures so it can wake up that much early and spin for the rest. How far ahead it wakes is set by
+     *  PowerPlant::Configuration::timer_spin_margin.
+     */
+    struct ChronoStatistics {
+
+        ChronoStatistics()
+            : period()
+            , wake_lateness()
+            , wake_deviation()
+            , wake_offset()
+            , dispatched(0)
+            , wakeups(0)
+            , mean_lateness()
+            , max_lateness()
+            , spin_time() {}
+
+        /// @brief the length of time these statistics cover
+        clock::duration period;
+        /// @brief the average time the operating system wakes the controller after the time it asked for
+        clock::duration wake_lateness;
+        /// @brief the average deviation of the wake-up lateness from its average
+        clock::duration wake_deviation;
+        /// @brief how far before each timer the controller wakes up to spin
+        clock::duration wake_offset;
+        /// @brief the number of timers that were run
+        uint64_t dispatched;
+        /// @brief the number of times the controller woke up to run timers, timers due together share a wake-up
+        uint64_t wakeups;
+        /// @brief the average time the timers were run after their scheduled time
+        clock::duration mean_lateness;
+        /// @brief the longest time a timer was run after its scheduled time
+        clock::duration max_lateness;
+        /// @brief the total time the controller spent spinning
+        clock::duration spin_time;
+    };
+
+}  // namespace message
+}  // namespace NUClear
+
+#endif  // NUCLEAR_MESSAGE_CHRONOSTATISTICS_HPP
@@ -19,10 +19,12 @@
 #ifndef NUCLEAR_MESSAGE_REACTIONSTATISTICS_HPP
 #define NUCLEAR_MESSAGE_REACTIONSTATISTICS_HPP
 
-#include <string>
-#include <vector>
+#include <memory>
+#include <utility>
 
 #include "../clock.hpp"
+#include "../threading/ReactionIdentifiers.hpp"
+#include "../util/FreeList.hpp"
 
 namespace NUClear {
 namespace message {
@@ -41,9 +43,13 @@ namespace message {
             , emitted()
             , started()
             , finished()
-            , exception(nullptr) {}
+            , exception(nullptr)
+            , deadline(clock::time_point::max())
+            , missed_deadlines(0)
+            , mailbox_occupancy(0)
+            , mailbox_dropped(0) {}
 
-        ReactionStatistics(const std::vector<std::string> identifier,
+        ReactionStatistics(std::shared_ptr<const threading::ReactionIdentifiers> identifier,
                            uint64_t reaction_id,
                            uint64_t task_id,
                            uint64_t cause_reaction_id,
@@ -51,8 +57,12 @@ namespace message {
                            const clock::time_point& emitted,
                            const clock::time_point& start,
                            const clock::time_point& finish,
-                           const std::exception_ptr& exception)
-            : identifier(identifier)
+                           const std::exception_ptr& exception,
+                           const clock::time_point& deadline = clock::time_point::max(),
+                           uint64_t missed_deadlines         = 0,
+                           uint64_t mailbox_occupancy        = 0,
+                           uint64_t mailbox_dropped          = 0)
+            : identifier(std::move(identifier))
             , reaction_id(reaction_id)
             , task_id(task_id)
             , cause_reaction_id(cause_reaction_id)
@@ -60,10 +70,28 @@ namespace message {
             , emitted(emitted)
             , started(start)
             , finished(finish)
-            , exception(exception) {}
+            , exception(exception)
+            , deadline(deadline)
+            , missed_deadlines(missed_deadlines)
+            , mailbox_occupancy(mailbox_occupancy)
+            , mailbox_dropped(mailbox_dropped) {}
 
-        /// @brief A string containing the username/on arguments/and callback name of the reaction.
-        std::vector<std::string> identifier;
+        /// @brief Statistics are made for every task, so they are allocated from a per thread free list
+        static void* operator new(std::size_t size) {
+            return size == sizeof(ReactionStatistics) ? util::FreeList<sizeof(ReactionStatistics)>::allocate()
+                                                      : ::operator new(size);
+        }
+
+        /// @brief Returns the statistics' memory to the free list, this may happen on any thread
+        static void operator delete(void* ptr, std::size_t size) {
+            if (size == sizeof(ReactionStatistics)) { util::FreeList<sizeof(ReactionStatistics)>::deallocate(ptr); }
+            else {
+                ::operator delete(ptr);
+            }
+        }
+
+        /// @brief The names (label, reactor, DSL and callback) that identify the reaction, shared with the reaction
+        std::shared_ptr<const threading::ReactionIdentifiers> identifier;
         /// @brief The id of this reaction.
         uint64_t reaction_id;
         /// @brief The task id of this reaction.
@@ -80,6 +108,14 @@ namespace message {
         clock::time_point finished;
         /// @brief An exception pointer that can be rethrown (if the reaction threw an exception)
         std::exception_ptr exception;
+        /// @brief The time this reaction had to finish by, or the maximum time point if it does not have a deadline
+        clock::time_point deadline;
+        /// @brief The number of times this reaction has finished after its deadline, including this time
+        uint64_t missed_deadlines;
+        /// @brief The number of other tasks waiting in this reaction's Mailbox when this one started running
+        uint64_t mailbox_occupancy;
+        /// @brief The number of tasks this reaction's Mailbox has discarded because it was full
+        uint64_t mailbox_dropped;
     };
 
 }  // namespace message
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_THREADING_BATCHER_HPP
+#define NUCLEAR_THREADING_BATCHER_HPP
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NUClear {
+namespace threading {
+
+    /**
+     * @brief The part of a batch collector that a reaction can hold without knowing the type being collected.
+     */
+    class Batcher {
+    public:
+        virtual ~Batcher() = default;
+    };
+
+    /**
+     * @brief Collects emitted data into batches so that a reaction runs once per batch rather than once per emission.
+     *
+     * @details
+     *  A batch is handed out once it reaches its capacity, or if it has been expired by a timeout. Each batch has a
+     *  generation so a timeout armed for one batch can't expire a later batch early.
+     *
+     * @tparam T the type of data being collected
+     */
+    template <typename T>
+    class TypedBatcher : public Batcher {
+    public:
+        /**
+         * @brief Constructs a new TypedBatcher.
+         *
+         * @param capacity  the number of items in a full batch
+         * @param arm       arms a timeout for the batch with the given generation (or empty for no timeout)
+         */
+        TypedBatcher(size_t capacity, std::function<void(uint64_t)>&& arm)
+            : capacity(capacity), arm(std::move(arm)), generation(0), expired(false) {
+            items.reserve(capacity);
+        }
+
+        /**
+         * @brief Adds an item to the current batch, arming a timeout for the batch if the item started it.
+         *
+         * @param item the item to add
+         *
+         * @return the batch if it is now ready to run, otherwise an empty vector
+         */
+        std::vector<std::shared_ptr<const T>> add(std::shared_ptr<const T>&& item) {
+            std::vector<std::shared_ptr<const T>> batch;
+            bool started;
+            uint64_t current;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+
+                items.push_back(std::move(item));
+                started = items.size() == 1;
+                current = generation;
+
+                if (items.size() >= capacity || expired) { batch = take(); }
+            }
+
+            // Arm the timeout outside the lock as it emits to the chrono controller
+            if (started && batch.empty() && arm) { arm(current); }
+
+            return batch;
+        }
+
+        /**
+         * @brief Marks a batch as expired so the next call to take_expired will hand it out.
+         *
+         * @param batch the generation of the batch the timeout was armed for
+         *
+         * @return true if that batch is still collecting and now has expired
+         */
+        bool expire(uint64_t batch) {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            expired = batch == generation && !items.empty();
+            return expired;
+        }
+
+        /**
+         * @brief Hands out the current batch if it has expired.
+         *
+         * @return the batch if it has expired, otherwise an empty vector
+         */
+        std::vector<std::shared_ptr<const T>> take_expired() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return expired ? take() : std::vector<std::shared_ptr<const T>>();
+        }
+
+    private:
+        /// @brief hands out the current batch and starts a new one, must be called with the mutex held
+        std::vector<std::shared_ptr<const T>> take() {
+            std::vector<std::shared_ptr<const T>> batch;
+            batch.reserve(capacity);
+            std::swap(batch, items);
+
+            ++generation;
+            expired = false;
+
+            return batch;
+        }
+
+        /// @brief the number of items in a full batch
+        const size_t capacity;
+        /// @brief arms a timeout for the batch with the given generation
+        std::function<void(uint64_t)> arm;
+        /// @brief the generation of the batch that is currently collecting
+        uint64_t generation;
+        /// @brief if the batch that is currently collecting has timed out
+        bool expired;
+        /// @brief the items in the batch that is currently collecting
+        std::vector<std::shared_ptr<const T>> items;
+        /// @brief protects the batch that is currently collecting
+        std::mutex mutex;
+    };
+
+}  // namespace threading
+}  // namespace NUClear
+
+#endif  // NUCLEAR_THREADING_BATCHER_HPP
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_THREADING_COALESCER_HPP
+#define NUCLEAR_THREADING_COALESCER_HPP
+
+#include <atomic>
+#include <cstdint>
+
+namespace NUClear {
+namespace threading {
+
+    /**
+     * @brief Tracks if a reaction has a task waiting to run, so that new emissions can be folded into it.
+     *
+     * @details
+     *  While a task is waiting to run, new emissions don't make tasks at all, they just mark the waiting task as stale.
+     *  When a stale task starts running it binds its data again so it runs with the latest data.
+     */
+    class Coalescer {
+    private:
+        enum State { IDLE, PENDING, STALE };
+
+    public:
+        Coalescer() : coalesced(0), state(IDLE) {}
+
+        /**
+         * @brief Called before making a new task, to claim the right to be the task that is waiting to run.
+         *
+         * @return true if a new task should be made, false if a task is already waiting and will use the new data
+         */
+        bool claim() {
+            State s = state.load();
+            while (true) {
+                if (s == IDLE) {
+                    if (state.compare_exchange_weak(s, PENDING)) { return true; }
+                }
+                else if (s == PENDING) {
+                    if (state.compare_exchange_weak(s, STALE)) {
+                        ++coalesced;
+                        return false;
+                    }
+                }
+                else {
+                    ++coalesced;
+                    return false;
+                }
+            }
+        }
+
+        /**
+         * @brief Gives up a claim when the new task could not be made after all.
+         */
+        void release() {
+            state.store(IDLE);
+        }
+
+        /**
+         * @brief Called when the waiting task starts running, after which new emissions will make new tasks again.
+         *
+         * @return true if emissions arrived while the task was waiting, so it should bind its data again
+         */
+        bool start() {
+            return state.exchange(IDLE) == STALE;
+        }
+
+        /// @brief the number of emissions that were folded into a waiting task instead of making a new one
+        std::atomic<uint64_t> coalesced;
+
+    private:
+        /// @brief if there is a task waiting to run, and if there has been an emission since it was made
+        std::atomic<State> state;
+    };
+
+}  // namespace threading
+}  // namespace NUClear
+
+#endif  // NUCLEAR_THREADING_COALESCER_HPP
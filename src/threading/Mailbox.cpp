@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "Mailbox.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace NUClear {
+namespace threading {
+
+    namespace {
+        /**
+         * @brief Swaps the bound data (and the statistics that go with it) of two tasks of the same reaction
+         *
+         * @param a the first task
+         * @param b the second task
+         */
+        void swap_data(ReactionTask& a, ReactionTask& b) {
+            std::swap(a.callback, b.callback);
+            std::swap(a.stats, b.stats);
+            std::swap(a.deadline, b.deadline);
+            std::swap(a.emit_stats, b.emit_stats);
+            if (a.stats) { a.stats->task_id = a.id; }
+            if (b.stats) { b.stats->task_id = b.id; }
+        }
+    }  // namespace
+
+    Mailbox::Mailbox(size_t capacity, Policy policy, const clock::duration& timeout)
+        : capacity(capacity), policy(policy), timeout(timeout), dropped(0) {}
+
+    bool Mailbox::wait_for_space() {
+
+        // We always accept new data when dropping the oldest
+        if (policy == DROP_OLDEST) { return true; }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        bool ok = policy == BLOCK ? space.wait_for(lock, timeout, [this] { return tasks.size() < capacity; })
+                                  : tasks.size() < capacity;
+        if (!ok) { ++dropped; }
+        return ok;
+    }
+
+    bool Mailbox::admit(std::unique_ptr<ReactionTask>& task) {
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (tasks.size() < capacity) {
+            tasks.push_back(task.get());
+            task->in_mailbox = true;
+            return true;
+        }
+
+        ++dropped;
+
+        // Shuffle the data along the waiting tasks so it stays in order, the newest task gets our new data and the
+        // oldest data ends up in the task we are discarding
+        if (policy == DROP_OLDEST && !tasks.empty()) {
+            for (size_t i = 0; i + 1 < tasks.size(); ++i) {
+                swap_data(*tasks[i], *tasks[i + 1]);
+            }
+            swap_data(*tasks.back(), *task);
+        }
+
+        return false;
+    }
+
+    void Mailbox::remove(ReactionTask& task) {
+
+        /* Mutex Scope */ {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!task.in_mailbox) { return; }
+
+            tasks.erase(std::find(tasks.begin(), tasks.end(), &task));
+            task.in_mailbox = false;
+        }
+
+        // Let a blocked emitter know there is space now
+        space.notify_one();
+    }
+
+    size_t Mailbox::size() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return tasks.size();
+    }
+
+}  // namespace threading
+}  // namespace NUClear
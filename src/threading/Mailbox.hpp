@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_THREADING_MAILBOX_HPP
+#define NUCLEAR_THREADING_MAILBOX_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "../clock.hpp"
+#include "ReactionTask.hpp"
+
+namespace NUClear {
+namespace threading {
+
+    /**
+     * @brief A bounded queue that tracks the tasks of a reaction that are waiting to run.
+     *
+     * @details
+     *  When a new task arrives while the mailbox is full, what happens depends on the policy.
+     *  DROP_NEWEST discards the new task. DROP_OLDEST discards the data of the oldest waiting task, shuffling the data
+     *  of the other waiting tasks along so that they still run in order, and gives the new data to the newest waiting
+     *  task. The tasks keep their places in the queue. BLOCK makes the emitting thread wait for a
+     *  task to start running, and if none does before the timeout the new task is discarded.
+     */
+    class Mailbox {
+    public:
+        /// @brief What to do with new tasks when the mailbox is full
+        enum Policy { DROP_NEWEST, DROP_OLDEST, BLOCK };
+
+        /**
+         * @brief Constructs a new Mailbox.
+         *
+         * @param capacity  the number of tasks that can be waiting to run at once
+         * @param policy    what to do with new tasks when the mailbox is full
+         * @param timeout   how long to block the emitting thread for when using the BLOCK policy
+         */
+        Mailbox(size_t capacity, Policy policy, const clock::duration& timeout = clock::duration::zero());
+
+        /**
+         * @brief Checks if there is space for a new task before its data is bound, waiting for it if we block.
+         *
+         * @return false if a new task should be discarded without being made
+         */
+        bool wait_for_space();
+
+        /**
+         * @brief Tries to put a new task into the mailbox.
+         *
+         * @details
+         *  If the mailbox is full and the policy is DROP_OLDEST, the callbacks and statistics of the waiting tasks are
+         *  shuffled along to make room for the new one. The passed task then holds the oldest callback.
+         *
+         * @param task the new task
+         *
+         * @return true if the task was added and should be submitted, false if the passed task should be discarded
+         */
+        bool admit(std::unique_ptr<ReactionTask>& task);
+
+        /**
+         * @brief Removes a task from the mailbox as it has started running or is being destroyed.
+         *
+         * @param task the task to remove
+         */
+        void remove(ReactionTask& task);
+
+        /**
+         * @brief Gets the number of tasks that are waiting to run.
+         *
+         * @return the number of tasks in the mailbox
+         */
+        size_t size();
+
+        /// @brief the number of tasks that can be waiting to run at once
+        const size_t capacity;
+        /// @brief what to do with new tasks when the mailbox is full
+        const Policy policy;
+        /// @brief how long to block the emitting thread for when using the BLOCK policy
+        const clock::duration timeout;
+        /// @brief the number of tasks (or their data) that have been discarded because the mailbox was full
+        std::atomic<uint64_t> dropped;
+
+    private:
+        /// @brief the tasks that are waiting to run, oldest first
+        std::deque<ReactionTask*> tasks;
+        /// @brief a mutex to ensure data consistency
+        std::mutex mutex;
+        /// @brief the condition that blocked emitters wait on for space in the mailbox
+        std::condition_variable space;
+    };
+
+}  // namespace threading
+}  // namespace NUClear
+
+#endif  // NUCLEAR_THREADING_MAILBOX_HPP
@@ -25,14 +25,24 @@ namespace threading {
     // Initialize our reaction source
     std::atomic<uint64_t> Reaction::reaction_id_source(0);  // NOLINT
 
-    Reaction::Reaction(Reactor& reactor, std::vector<std::string>&& identifier, TaskGenerator&& generator)
+    Reaction::Reaction(Reactor& reactor,
+                       std::shared_ptr<const ReactionIdentifiers>&& identifier,
+                       TaskGenerator&& generator)
         : reactor(reactor)
-        , identifier(identifier)
+        , identifier(std::move(identifier))
         , id(++reaction_id_source)
         , emit_stats(true)
         , active_tasks(0)
         , enabled(true)
-        , generator(generator) {}
+        , sync_group(nullptr)
+        , pool(nullptr)
+        , main_thread(false)
+        , deadline(clock::duration::zero())
+        , missed_deadlines(0)
+        , mailbox(nullptr)
+        , coalescer(nullptr)
+        , batcher(nullptr)
+        , generator(std::move(generator)) {}
 
     void Reaction::unbind() {
         // Unbind
@@ -46,13 +56,33 @@ namespace threading {
         // If we are not enabled, don't run
         if (!enabled) { return std::unique_ptr<ReactionTask>(nullptr); }
 
+        // If our mailbox is full we might not want a new task, so check before we go to the effort of making one
+        if (mailbox && !mailbox->wait_for_space()) { return std::unique_ptr<ReactionTask>(nullptr); }
+
+        // If we already have a task waiting to run it will pick up this data when it starts, so we don't need another
+        if (coalescer && !coalescer->claim()) { return std::unique_ptr<ReactionTask>(nullptr); }
+
         // Run our generator to get a functor we can run
         int priority;
-        std::function<std::unique_ptr<ReactionTask>(std::unique_ptr<ReactionTask> &&)> func;
+        ReactionTask::TaskFunction func;
         std::tie(priority, func) = generator(*this);
 
+        // If we couldn't make a task there is nothing waiting to run
+        if (coalescer && !func) { coalescer->release(); }
+
         // If our generator returns a valid function
-        if (func) { return std::make_unique<ReactionTask>(*this, priority, std::move(func)); }
+        if (func) {
+            auto task = std::make_unique<ReactionTask>(*this, priority, std::move(func));
+
+            // If our mailbox didn't take the task, the callback it holds now will never run so it is no longer active
+            if (mailbox && !mailbox->admit(task)) {
+                --active_tasks;
+                if (coalescer) { coalescer->release(); }
+                return std::unique_ptr<ReactionTask>(nullptr);
+            }
+
+            return task;
+        }
 
         // Otherwise we return a null pointer
         return std::unique_ptr<ReactionTask>(nullptr);
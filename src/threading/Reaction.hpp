@@ -24,6 +24,10 @@
 #include <memory>
 #include <string>
 
+#include "Batcher.hpp"
+#include "Coalescer.hpp"
+#include "Mailbox.hpp"
+#include "ReactionIdentifiers.hpp"
 #include "ReactionTask.hpp"
 
 namespace NUClear {
@@ -33,6 +37,10 @@ class Reactor;
 
 namespace threading {
 
+    // Forward declare the scheduling types
+    class SyncGroup;
+    class TaskScheduler;
+
     /**
      * @brief This class holds the definition of a Reaction (call signature).
      *
@@ -49,16 +57,18 @@ namespace threading {
 
     public:
         // The type of the generator that is used to create functions for ReactionTask objects
-        using TaskGenerator = std::function<std::pair<int, ReactionTask::TaskFunction>(Reaction&)>;
+        using TaskGenerator = util::SmallFunction<std::pair<int, ReactionTask::TaskFunction>(Reaction&), 64>;
 
         /**
          * @brief Constructs a new Reaction with the passed callback generator and options
          *
          * @param reactor        the reactor this belongs to
-         * @param identifier     string identifier information about the reaction to help identify it
+         * @param identifier     the names that identify the reaction
          * @param callback       the callback generator function (creates databound callbacks)
          */
-        Reaction(Reactor& reactor, std::vector<std::string>&& identifier, TaskGenerator&& generator);
+        Reaction(Reactor& reactor,
+                 std::shared_ptr<const ReactionIdentifiers>&& identifier,
+                 TaskGenerator&& generator);
 
         /**
          * @brief creates a new databound callback task that can be executed.
@@ -75,8 +85,8 @@ namespace threading {
         /// @brief the reactor this belongs to
         Reactor& reactor;
 
-        /// @brief This holds the demangled name of the On function that is being called
-        std::vector<std::string> identifier;
+        /// @brief the names that identify this reaction, shared with the statistics and log messages of its tasks
+        std::shared_ptr<const ReactionIdentifiers> identifier;
 
         /// @brief the unique identifier for this Reaction object
         const uint64_t id;
@@ -92,6 +102,22 @@ namespace threading {
 
         /// @brief list of functions to use to unbind the reaction and clean
         std::vector<std::function<void(Reaction&)>> unbinders;
+        /// @brief the sync group that this reaction's tasks must be admitted by before they run (or nullptr for none)
+        SyncGroup* sync_group;
+        /// @brief the scheduler of the separate thread pool this reaction's tasks run on (or nullptr for the default)
+        TaskScheduler* pool;
+        /// @brief if this reaction's tasks must run on the main thread
+        bool main_thread;
+        /// @brief how long after being emitted this reaction's tasks must finish by (or zero for no deadline)
+        clock::duration deadline;
+        /// @brief the number of this reaction's tasks that have finished after their deadline
+        std::atomic<uint64_t> missed_deadlines;
+        /// @brief the bounded queue of this reaction's tasks that are waiting to run (or nullptr if it is unbounded)
+        std::unique_ptr<Mailbox> mailbox;
+        /// @brief folds emissions into this reaction's waiting task rather than making new tasks (or nullptr if not)
+        std::unique_ptr<Coalescer> coalescer;
+        /// @brief collects this reaction's data into batches so its tasks run once per batch (or nullptr if not)
+        std::unique_ptr<Batcher> batcher;
 
     private:
         /**
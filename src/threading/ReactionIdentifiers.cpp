@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "ReactionIdentifiers.hpp"
+
+#include "../util/demangle.hpp"
+
+namespace NUClear {
+namespace threading {
+
+    ReactionIdentifiers::ReactionIdentifiers(const std::string& name,
+                                             const std::string& reactor,
+                                             const char* dsl_symbol,
+                                             const char* function_symbol)
+        : name(name), reactor(reactor), dsl_symbol(dsl_symbol), function_symbol(function_symbol) {}
+
+    const std::string& ReactionIdentifiers::dsl() const {
+        std::call_once(dsl_flag, [this] { dsl_name = util::demangle(dsl_symbol); });
+        return dsl_name;
+    }
+
+    const std::string& ReactionIdentifiers::function() const {
+        std::call_once(function_flag, [this] { function_name = util::demangle(function_symbol); });
+        return function_name;
+    }
+
+}  // namespace threading
+}  // namespace NUClear
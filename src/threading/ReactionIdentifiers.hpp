@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_THREADING_REACTIONIDENTIFIERS_HPP
+#define NUCLEAR_THREADING_REACTIONIDENTIFIERS_HPP
+
+#include <mutex>
+#include <string>
+
+namespace NUClear {
+namespace threading {
+
+    /**
+     * @brief The names that identify a reaction, made once per reaction and shared by everything that describes it.
+     *
+     * @details
+     *  Statistics and log messages refer to these rather than holding copies of the strings. The DSL and callback
+     *  type names are only demangled the first time they are looked at, as most reactions are never inspected and
+     *  demangling every one of them slows down startup.
+     */
+    class ReactionIdentifiers {
+    public:
+        /**
+         * @brief Creates the identifiers for a reaction.
+         *
+         * @param name            the label the reaction was given when it was bound
+         * @param reactor         the name of the reactor the reaction belongs to
+         * @param dsl_symbol      the mangled name of the reaction's DSL type
+         * @param function_symbol the mangled name of the reaction's callback type
+         */
+        ReactionIdentifiers(const std::string& name,
+                            const std::string& reactor,
+                            const char* dsl_symbol,
+                            const char* function_symbol);
+
+        /// @brief the label the reaction was given when it was bound
+        const std::string name;
+        /// @brief the name of the reactor the reaction belongs to
+        const std::string reactor;
+
+        /**
+         * @brief Gets the demangled name of the reaction's DSL type, demangling it if this is the first time.
+         */
+        const std::string& dsl() const;
+
+        /**
+         * @brief Gets the demangled name of the reaction's callback type, demangling it if this is the first time.
+         */
+        const std::string& function() const;
+
+    private:
+        /// @brief the mangled name of the DSL type, this comes from typeid so it lives for the whole program
+        const char* dsl_symbol;
+        /// @brief the mangled name of the callback type, this comes from typeid so it lives for the whole program
+        const char* function_symbol;
+
+        /// @brief flags for demangling each name once, even when several threads look at it at the same time
+        mutable std::once_flag dsl_flag;
+        mutable std::once_flag function_flag;
+
+        /// @brief the demangled names, empty until they are first looked at
+        mutable std::string dsl_name;
+        mutable std::string function_name;
+    };
+
+}  // namespace threading
+}  // namespace NUClear
+
+#endif  // NUCLEAR_THREADING_REACTIONIDENTIFIERS_HPP
@@ -19,6 +19,7 @@
 
 #include <utility>
 
+#include "../util/FreeList.hpp"
 #include "Reaction.hpp"
 
 namespace NUClear {
@@ -30,32 +31,106 @@ namespace threading {
     // Initialize our current task
     ATTRIBUTE_TLS ReactionTask* ReactionTask::current_task = nullptr;  // NOLINT
 
+    // Initialize our statistics subscriber count
+    std::atomic<size_t> ReactionTask::statistics_subscribers(0);  // NOLINT
+
     ReactionTask::ReactionTask(Reaction& parent, int priority, TaskFunction&& callback)
         : parent(parent)
         , id(++task_id_source)
         , priority(priority)
-        , stats(new message::ReactionStatistics{parent.identifier,
-                                                parent.id,
-                                                id,
-                                                current_task != nullptr ? current_task->parent.id : 0,
-                                                current_task != nullptr ? current_task->id : 0,
-                                                clock::now(),
-                                                clock::time_point(std::chrono::seconds(0)),
-                                                clock::time_point(std::chrono::seconds(0)),
-                                                nullptr})
+        , stats(nullptr)
         , emit_stats(parent.emit_stats && (current_task != nullptr ? current_task->emit_stats : true))
-        , callback(callback) {}
+        , admitted(false)
+        , deadline(clock::time_point::max())
+        , in_mailbox(false)
+        , callback(std::move(callback)) {
+
+        // Only collect statistics if they would be emitted to someone
+        bool collect_stats = emit_stats && statistics_subscribers.load(std::memory_order_relaxed) > 0;
+        bool has_deadline  = parent.deadline > clock::duration::zero();
+
+        // We only need to know when we were emitted for our statistics or to work out our deadline
+        if (collect_stats || has_deadline) {
+            clock::time_point emitted = clock::now();
+
+            if (has_deadline) { deadline = emitted + parent.deadline; }
+
+            if (collect_stats) {
+                stats.reset(new message::ReactionStatistics{parent.identifier,
+                                                            parent.id,
+                                                            id,
+                                                            current_task != nullptr ? current_task->parent.id : 0,
+                                                            current_task != nullptr ? current_task->id : 0,
+                                                            emitted,
+                                                            clock::time_point(std::chrono::seconds(0)),
+                                                            clock::time_point(std::chrono::seconds(0)),
+                                                            nullptr,
+                                                            deadline});
+            }
+        }
+    }
+
+    ReactionTask::~ReactionTask() {
+        if (parent.mailbox) { parent.mailbox->remove(*this); }
+    }
+
+    void* ReactionTask::operator new(std::size_t size) {
+        return size == sizeof(ReactionTask) ? util::FreeList<sizeof(ReactionTask)>::allocate() : ::operator new(size);
+    }
+
+    void ReactionTask::operator delete(void* ptr, std::size_t size) {
+        if (size == sizeof(ReactionTask)) { util::FreeList<sizeof(ReactionTask)>::deallocate(ptr); }
+        else {
+            ::operator delete(ptr);
+        }
+    }
 
     const ReactionTask* ReactionTask::get_current_task() {
         return current_task;
     }
 
+    const message::ReactionStatistics& ReactionTask::get_stats() const {
+        if (!stats) {
+            stats.reset(new message::ReactionStatistics{parent.identifier,
+                                                        parent.id,
+                                                        id,
+                                                        0,
+                                                        0,
+                                                        clock::time_point(std::chrono::seconds(0)),
+                                                        clock::time_point(std::chrono::seconds(0)),
+                                                        clock::time_point(std::chrono::seconds(0)),
+                                                        nullptr,
+                                                        deadline});
+        }
+        return *stats;
+    }
+
     std::unique_ptr<ReactionTask> ReactionTask::run(std::unique_ptr<ReactionTask>&& us) {
 
         // Update our current task
         auto old_task = current_task;
         current_task  = this;
 
+        // We are no longer waiting in our reaction's mailbox
+        if (parent.mailbox) {
+            parent.mailbox->remove(*this);
+            if (stats) {
+                stats->mailbox_occupancy = parent.mailbox->size();
+                stats->mailbox_dropped   = parent.mailbox->dropped;
+            }
+        }
+
+        // If emissions were folded into us while we waited, bind our data again so we run with the latest data
+        if (parent.coalescer && parent.coalescer->start()) {
+            auto latest = parent.generator(parent);
+            if (latest.second) {
+                callback = std::move(latest.second);
+
+                // The callback we replaced will never run so it is no longer active
+                --parent.active_tasks;
+            }
+        }
+
         // Run our callback at catch the returned task (to see if it rescheduled itself)
         us = callback(std::move(us));
 
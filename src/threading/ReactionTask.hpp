@@ -20,12 +20,14 @@
 #define NUCLEAR_THREADING_REACTIONTASK_HPP
 
 #include <atomic>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <typeindex>
 #include <vector>
 
 #include "../message/ReactionStatistics.hpp"
+#include "../util/SmallFunction.hpp"
 #include "../util/platform.hpp"
 
 namespace NUClear {
@@ -50,8 +52,13 @@ namespace threading {
         static ATTRIBUTE_TLS ReactionTask* current_task;
 
     public:
-        /// Type of the functions that ReactionTasks execute
-        using TaskFunction = std::function<std::unique_ptr<ReactionTask>(std::unique_ptr<ReactionTask>&&)>;
+        /// @brief the number of reactions that trigger on ReactionStatistics, tasks only collect statistics when this
+        /// is not zero
+        static std::atomic<size_t> statistics_subscribers;
+
+        /// Type of the functions that ReactionTasks execute, the buffer is large enough to hold the data for most DSLs
+        /// without going to the heap
+        using TaskFunction = util::SmallFunction<std::unique_ptr<ReactionTask>(std::unique_ptr<ReactionTask>&&), 96>;
 
         /**
          * @brief Gets the current executing task, or nullptr if there isn't one.
@@ -69,6 +76,26 @@ namespace threading {
          */
         ReactionTask(Reaction& parent, int priority, TaskFunction&& callback);
 
+        /**
+         * @brief Destroys the task, removing it from its reaction's mailbox if it never ran.
+         */
+        ~ReactionTask();
+
+        /**
+         * @brief Allocates a task from a per thread free list so creating tasks does not go to the global heap.
+         *
+         * @param size the size of the object being allocated
+         */
+        static void* operator new(std::size_t size);
+
+        /**
+         * @brief Returns a task's memory to the free list, it may be called from any thread.
+         *
+         * @param ptr  the memory to return
+         * @param size the size of the object that was allocated
+         */
+        static void operator delete(void* ptr, std::size_t size);
+
         /**
          * @brief Runs the internal data bound task and times it.
          *
@@ -78,17 +105,36 @@ namespace threading {
          */
         std::unique_ptr<ReactionTask> run(std::unique_ptr<ReactionTask>&& us);
 
+        /**
+         * @brief Gets the statistics for this task, creating them if they were not collected when it was made.
+         *
+         * @details
+         *  Statistics are only collected while something triggers on ReactionStatistics. When a task without them
+         *  needs to describe itself (e.g. to log a message) a statistics object is made holding what the task knows
+         *  about itself. Its timing and cause information will not be filled in.
+         *
+         * @return the statistics for this task
+         */
+        const message::ReactionStatistics& get_stats() const;
+
         /// @brief the parent Reaction object which spawned this
         Reaction& parent;
         /// @brief the task id of this task (the sequence number of this particular task)
         uint64_t id;
         /// @brief the priority to run this task at
         int priority;
-        /// @brief the statistics object that persists after this for information and debugging
-        std::unique_ptr<message::ReactionStatistics> stats;
+        /// @brief the statistics object that persists after this for information and debugging, or nullptr if nothing
+        /// is collecting statistics
+        mutable std::unique_ptr<message::ReactionStatistics> stats;
         /// @brief if these stats are safe to emit. It should start true, and as soon as we are a reaction based on
         /// reaction statistics becomes false for all created tasks. This is to stop infinite loops of death.
         bool emit_stats;
+        /// @brief if this task has been admitted to run by the sync group of its reaction
+        bool admitted;
+        /// @brief the time this task must finish by, or the maximum time point if it does not have a deadline
+        clock::time_point deadline;
+        /// @brief if this task is waiting to run in its reaction's mailbox
+        bool in_mailbox;
 
         /// @brief the data bound callback to be executed
         /// @attention note this must be last in the list as the this pointer is passed to the callback generator
@@ -101,15 +147,19 @@ namespace threading {
      * @param a the reaction task a
      * @param b the reaction task b
      *
-     * @return true if a has lower priority than b, false otherwise
+     * @return true if a should run after b, false otherwise
      */
     inline bool operator<(const std::unique_ptr<ReactionTask>& a, const std::unique_ptr<ReactionTask>& b) {
 
         // If we ever have a null pointer, we move it to the top of the queue as it is being removed
-        return a == nullptr ? false
-                            : b == nullptr ? true
-                                           : a->priority == b->priority ? a->stats->emitted > b->stats->emitted
-                                                                        : a->priority < b->priority;
+        // Tasks of equal priority run earliest deadline first, and tasks without a deadline have the latest possible
+        // one. Task ids are handed out in creation order so they sort the rest by their emit time
+        return a == nullptr
+                   ? false
+                   : b == nullptr ? true
+                                  : a->priority != b->priority
+                                        ? a->priority < b->priority
+                                        : a->deadline != b->deadline ? a->deadline > b->deadline : a->id > b->id;
     }
 
 }  // namespace threading
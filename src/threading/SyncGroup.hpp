@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_THREADING_SYNCGROUP_HPP
+#define NUCLEAR_THREADING_SYNCGROUP_HPP
+
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <vector>
+
+#include "ReactionTask.hpp"
+
+namespace NUClear {
+namespace threading {
+
+    /**
+     * @brief A group of reactions that only allows one of their tasks to run at a time.
+     *
+     * @details
+     *  Tasks are admitted to the group when they are submitted. If another task from the group is already running
+     *  the new task is parked in the group, without being queued or waking any threads, until the running task is
+     *  finished and releases it.
+     *  Parked tasks are released in order of their priority, then the order they were created in.
+     */
+    class SyncGroup {
+    public:
+        SyncGroup() : running(false) {}
+
+        /**
+         * @brief Tries to admit a task so it can be run.
+         *
+         * @details
+         *  If no other task from the group is running, the task is admitted and the group becomes busy. Otherwise the
+         *  task is taken and parked in the group until it is released.
+         *
+         * @param task the task that wants to run, this will be empty if the task was parked
+         *
+         * @return true if the task was admitted and can be run, false if it was parked
+         */
+        bool admit(std::unique_ptr<ReactionTask>& task) {
+
+            std::lock_guard<std::mutex> lock(mutex);
+
+            if (running) {
+                queue.push(std::move(task));
+                return false;
+            }
+
+            running        = true;
+            task->admitted = true;
+            return true;
+        }
+
+        /**
+         * @brief Releases the group when the running task is finished, handing it directly to the next parked task.
+         *
+         * @return the parked task that is now admitted and should be scheduled, or nullptr if the group is now idle
+         */
+        std::unique_ptr<ReactionTask> release() {
+
+            std::lock_guard<std::mutex> lock(mutex);
+
+            // If nobody is waiting we are no longer running
+            if (queue.empty()) {
+                running = false;
+                return std::unique_ptr<ReactionTask>(nullptr);
+            }
+
+            // Priority queue's top is a const reference, so we need to cast to move the task out of it
+            std::unique_ptr<ReactionTask> next(
+                std::move(const_cast<std::unique_ptr<ReactionTask>&>(queue.top())));  // NOLINT
+            queue.pop();
+
+            // The group stays running as it now belongs to the next task
+            next->admitted = true;
+            return next;
+        }
+
+    private:
+        /// @brief if a task from this group is currently running
+        bool running;
+        /// @brief the tasks waiting for their turn, sorted by priority
+        std::priority_queue<std::unique_ptr<ReactionTask>> queue;
+        /// @brief a mutex to ensure data consistency
+        std::mutex mutex;
+    };
+
+}  // namespace threading
+}  // namespace NUClear
+
+#endif  // NUCLEAR_THREADING_SYNCGROUP_HPP
@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "TaskQueue.hpp"
+
+#include <limits>
+
+#include "../dsl/word/Priority.hpp"
+
+namespace NUClear {
+namespace threading {
+
+    namespace {
+        /// @brief the priority of the tasks held in each of the buckets
+        constexpr std::array<int, 5> bucket_priority = {{dsl::word::Priority::IDLE::value,
+                                                         dsl::word::Priority::LOW::value,
+                                                         dsl::word::Priority::NORMAL::value,
+                                                         dsl::word::Priority::HIGH::value,
+                                                         dsl::word::Priority::REALTIME::value}};
+
+        /**
+         * @brief Gets the index of the highest set bit
+         *
+         * @param bits the bits to search
+         *
+         * @return the index of the highest set bit or -1 if no bits are set
+         */
+        inline int highest_bit(unsigned int bits) {
+            int index = -1;
+            for (; bits != 0; bits >>= 1) {
+                ++index;
+            }
+            return index;
+        }
+    }  // namespace
+
+    TaskQueue::TaskQueue()
+        : buckets()
+        , bitmap(0)
+        , spilled()
+        , mutex()
+        , overflow()
+        , overflow_size(0)
+        , overflow_priority(std::numeric_limits<int>::min())
+        , overflow_deadline(false) {
+        for (auto& s : spilled) {
+            s = 0;
+        }
+    }
+
+    TaskQueue::~TaskQueue() {
+        // Clean up any tasks that never got run
+        ReactionTask* task;
+        for (auto& b : buckets) {
+            while (b.pop(task)) {
+                delete task;  // NOLINT
+            }
+        }
+    }
+
+    int TaskQueue::bucket(int priority) {
+        switch (priority) {
+            case dsl::word::Priority::IDLE::value: return 0;
+            case dsl::word::Priority::LOW::value: return 1;
+            case dsl::word::Priority::NORMAL::value: return 2;
+            case dsl::word::Priority::HIGH::value: return 3;
+            case dsl::word::Priority::REALTIME::value: return 4;
+            default: return -1;
+        }
+    }
+
+    void TaskQueue::push(std::unique_ptr<ReactionTask>&& task) {
+
+        // Tasks with a deadline don't belong to a bucket as they have to be sorted by their deadline
+        int b = task->deadline == clock::time_point::max() ? bucket(task->priority) : -1;
+
+        // Standard priorities go in their bucket unless the level has spilled over or the bucket is full
+        if (b >= 0 && spilled[b] == 0 && buckets[b].push(task.get())) {
+            task.release();
+            bitmap.fetch_or(1u << b);
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        overflow.push(std::move(task));
+        if (b >= 0) { ++spilled[b]; }
+        overflow_priority = overflow.top()->priority;
+        overflow_deadline = overflow.top()->deadline != clock::time_point::max();
+        ++overflow_size;
+    }
+
+    std::unique_ptr<ReactionTask> TaskQueue::pop_overflow() {
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (overflow.empty()) { return nullptr; }
+
+        // Priority queue's top is a const reference, so we need to cast to move the task out of it
+        std::unique_ptr<ReactionTask> task(
+            std::move(const_cast<std::unique_ptr<ReactionTask>&>(overflow.top())));  // NOLINT
+        overflow.pop();
+
+        int b = task->deadline == clock::time_point::max() ? bucket(task->priority) : -1;
+        if (b >= 0) { --spilled[b]; }
+        overflow_priority = overflow.empty() ? std::numeric_limits<int>::min() : overflow.top()->priority;
+        overflow_deadline = !overflow.empty() && overflow.top()->deadline != clock::time_point::max();
+        --overflow_size;
+
+        return task;
+    }
+
+    std::unique_ptr<ReactionTask> TaskQueue::pop() {
+
+        unsigned int bits = bitmap;
+        while (true) {
+            int b = highest_bit(bits);
+
+            // The overflow heap wins if its top task is more important, or has a deadline at the same priority. Other
+            // ties go to the bucket as it has the older tasks
+            int top = overflow_priority;
+            if (overflow_size > 0
+                && (b < 0 || top > bucket_priority[b] || (top == bucket_priority[b] && overflow_deadline))) {
+                auto task = pop_overflow();
+                if (task) { return task; }
+            }
+
+            // There is nothing left for us to look at
+            if (b < 0) { return nullptr; }
+
+            ReactionTask* task;
+            if (buckets[b].pop(task)) { return std::unique_ptr<ReactionTask>(task); }
+
+            // The bucket is empty so clear its bit, but put it back if someone pushed while we were doing that
+            bitmap.fetch_and(~(1u << b));
+            if (!buckets[b].empty()) { bitmap.fetch_or(1u << b); }
+
+            // Move on to the next bucket
+            bits &= ~(1u << b);
+        }
+    }
+
+    int TaskQueue::top_priority() const {
+        int b = highest_bit(bitmap);
+        return std::max(b < 0 ? std::numeric_limits<int>::min() : bucket_priority[b],
+                        overflow_size > 0 ? int(overflow_priority) : std::numeric_limits<int>::min());
+    }
+
+}  // namespace threading
+}  // namespace NUClear
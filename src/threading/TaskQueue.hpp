@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_THREADING_TASKQUEUE_HPP
+#define NUCLEAR_THREADING_TASKQUEUE_HPP
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <queue>
+
+#include "../util/LockFreeQueue.hpp"
+#include "ReactionTask.hpp"
+
+namespace NUClear {
+namespace threading {
+
+    /**
+     * @brief A priority queue of tasks that is specialised for the standard priority levels.
+     *
+     * @details
+     *  Nearly every task runs at one of the levels provided by dsl::word::Priority (REALTIME, HIGH, NORMAL, LOW and
+     *  IDLE). Each of these levels has its own lock free FIFO bucket and a bitmap of which buckets are non empty, so
+     *  pushing and popping these tasks is constant time and does not take a lock. Tasks with any other priority, or
+     *  that arrive while their bucket is full, are placed in a mutex guarded overflow heap. Once a level has spilled
+     *  into the overflow heap its tasks keep going there until the heap has drained them, so tasks within a level still
+     *  run in the order they were submitted.
+     *  Tasks with a deadline always go in the overflow heap, which orders them earliest deadline first. At the same
+     *  priority they run before the tasks in the buckets, which have no deadline.
+     */
+    class TaskQueue {
+    public:
+        TaskQueue();
+        ~TaskQueue();
+
+        TaskQueue(const TaskQueue&) = delete;
+        TaskQueue& operator=(const TaskQueue&) = delete;
+
+        /**
+         * @brief Adds a task to the queue.
+         *
+         * @param task the task to add
+         */
+        void push(std::unique_ptr<ReactionTask>&& task);
+
+        /**
+         * @brief Removes the highest priority task from the queue.
+         *
+         * @return the task that was removed, or nullptr if no task could be taken
+         */
+        std::unique_ptr<ReactionTask> pop();
+
+        /**
+         * @brief Gets the priority of the most important task in the queue.
+         *
+         * @return the priority of the most important task, or the lowest possible int if the queue is empty
+         */
+        int top_priority() const;
+
+    private:
+        /// @brief the number of items each of the priority buckets can hold before they overflow
+        static constexpr size_t bucket_capacity = 1024;
+        /// @brief the number of standard priority levels that get their own bucket
+        static constexpr int n_buckets = 5;
+
+        /**
+         * @brief Gets the index of the bucket that holds tasks with this priority
+         *
+         * @param priority the priority of the task
+         *
+         * @return the bucket index or -1 if this is not one of the standard priority levels
+         */
+        static int bucket(int priority);
+
+        /**
+         * @brief Takes the most important task from the overflow heap.
+         *
+         * @return the task or nullptr if the heap was empty
+         */
+        std::unique_ptr<ReactionTask> pop_overflow();
+
+        /// @brief the lock free FIFO queues for each of the standard priority levels, lowest priority first
+        std::array<util::LockFreeQueue<ReactionTask*, bucket_capacity>, n_buckets> buckets;
+        /// @brief a bit for each bucket that is set while it has tasks in it
+        std::atomic<unsigned int> bitmap;
+        /// @brief the number of tasks of each standard priority level that are waiting in the overflow heap
+        std::array<std::atomic<size_t>, n_buckets> spilled;
+
+        /// @brief the mutex that protects the overflow heap
+        std::mutex mutex;
+        /// @brief the heap that holds tasks which do not fit in a bucket
+        std::priority_queue<std::unique_ptr<ReactionTask>> overflow;
+        /// @brief the number of tasks in the overflow heap
+        std::atomic<size_t> overflow_size;
+        /// @brief the priority of the task at the top of the overflow heap
+        std::atomic<int> overflow_priority;
+        /// @brief if the task at the top of the overflow heap has a deadline
+        std::atomic<bool> overflow_deadline;
+    };
+
+}  // namespace threading
+}  // namespace NUClear
+
+#endif  // NUCLEAR_THREADING_TASKQUEUE_HPP
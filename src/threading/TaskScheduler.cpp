@@ -18,10 +18,62 @@
 
 #include "TaskScheduler.hpp"
 
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#    include <immintrin.h>
+#endif
+
 namespace NUClear {
 namespace threading {
 
-    TaskScheduler::TaskScheduler() : running(true) {}
+    namespace {
+        /**
+         * @brief Tells the processor that we are in a spin wait loop so it can go easy on the other hyperthread
+         */
+        inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+            _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+            asm volatile("yield");
+#endif
+        }
+    }  // namespace
+
+    ATTRIBUTE_TLS TaskScheduler* TaskScheduler::current_scheduler = nullptr;  // NOLINT
+    ATTRIBUTE_TLS size_t TaskScheduler::current_worker            = 0;        // NOLINT
+    ATTRIBUTE_TLS size_t TaskScheduler::slot_chain                = 0;        // NOLINT
+
+    TaskScheduler::TaskScheduler(size_t thread_count,
+                                 bool work_stealing,
+                                 size_t spin_count,
+                                 size_t yield_count,
+                                 bool continuation_slot)
+        : running(true)
+        , work_stealing(work_stealing)
+        , continuation_slot(continuation_slot)
+        , worker_count(std::max(thread_count, size_t(1)))
+        , slots(continuation_slot ? worker_count : 0)
+        , next_worker(0)
+        , queued(0)
+        , sleeping(0)
+        , spin_count(spin_count)
+        , yield_count(yield_count) {
+
+        // Each pool thread gets its own queue when we are work stealing
+        if (work_stealing) {
+            for (size_t i = 0; i < worker_count; ++i) {
+                local_queues.push_back(std::make_unique<TaskQueue>());
+            }
+        }
+    }
+
+    TaskScheduler::~TaskScheduler() {
+        // Clean up any tasks that were left in the continuation slots
+        for (auto& slot : slots) {
+            delete slot.exchange(nullptr);  // NOLINT
+        }
+    }
 
     void TaskScheduler::shutdown() {
         {
@@ -36,46 +88,190 @@ namespace threading {
         // We do not accept new tasks once we are shutdown
         if (running) {
 
-            /* Mutex Scope */ {
-                std::lock_guard<std::mutex> lock(mutex);
-                queue.push(std::forward<std::unique_ptr<ReactionTask>>(task));
+            enqueue(std::forward<std::unique_ptr<ReactionTask>>(task));
+            ++queued;
+
+            // Only wake a thread if one is asleep, any thread that is still spinning will see this task by itself.
+            // A thread going to sleep increments sleeping before it checks queued, and we increment queued before we
+            // check sleeping, so at least one of us is guaranteed to see the other.
+            if (sleeping > 0) {
+
+                // Synchronise with any thread that is about to wait so it can't miss this task
+                /* Mutex Scope */ {
+                    std::lock_guard<std::mutex> lock(mutex);
+                }
+
+                // Notify a thread that it can proceed
+                condition.notify_one();
             }
         }
-
-        // Notify a thread that it can proceed
-        condition.notify_one();
     }
 
-    std::unique_ptr<ReactionTask> TaskScheduler::get_task() {
+    void TaskScheduler::submit(std::vector<std::unique_ptr<ReactionTask>>&& tasks) {
+
+        // We do not accept new tasks once we are shutdown
+        if (running && !tasks.empty()) {
+
+            for (auto& task : tasks) {
+                enqueue(std::move(task));
+            }
+            queued += tasks.size();
 
-        // Obtain the lock
-        std::unique_lock<std::mutex> lock(mutex);
+            // Wake up as many sleeping threads as we have tasks for, but no more than that
+            size_t sleepers = sleeping;
+            if (sleepers > 0) {
 
-        // While our queue is empty
-        while (queue.empty()) {
+                // Synchronise with any thread that is about to wait so it can't miss these tasks
+                /* Mutex Scope */ {
+                    std::lock_guard<std::mutex> lock(mutex);
+                }
+
+                if (tasks.size() >= sleepers) { condition.notify_all(); }
+                else {
+                    for (size_t i = 0; i < tasks.size(); ++i) {
+                        condition.notify_one();
+                    }
+                }
+            }
+        }
+    }
 
-            // If the queue is empty we either wait or shutdown
-            if (!running) {
+    void TaskScheduler::enqueue(std::unique_ptr<ReactionTask>&& task) {
 
-                // Notify any other threads that might be waiting on this condition
-                condition.notify_all();
+        if (current_scheduler == this) {
 
-                // Return a nullptr to signify there is nothing on the queue
-                return nullptr;
+            // The first task one of our pool threads makes goes in its slot so it can run it next while its data is hot
+            ReactionTask* empty = nullptr;
+            if (continuation_slot && slots[current_worker].compare_exchange_strong(empty, task.get())) {
+                task.release();
             }
+            // Tasks from our own pool threads go on that thread's queue
+            else if (work_stealing) {
+                local_queues[current_worker]->push(std::forward<std::unique_ptr<ReactionTask>>(task));
+            }
+            else {
+                queue.push(std::forward<std::unique_ptr<ReactionTask>>(task));
+            }
+        }
+        // Everything else goes on the shared queue
+        else {
+            queue.push(std::forward<std::unique_ptr<ReactionTask>>(task));
+        }
+    }
+
+    std::unique_ptr<ReactionTask> TaskScheduler::get_next_task() {
+
+        if (continuation_slot) {
+            std::unique_ptr<ReactionTask> next(slots[current_worker].exchange(nullptr));
+            if (next) {
+                int top = work_stealing ? std::max(queue.top_priority(), local_queues[current_worker]->top_priority())
+                                        : queue.top_priority();
 
-            // Wait for something to happen!
-            condition.wait(lock);
+                // Run our continuation straight away unless something more important is waiting, or we have run so
+                // many continuations in a row that the tasks in the queue could be starved
+                if (slot_chain < max_slot_chain && next->priority >= top) {
+                    ++slot_chain;
+                    return next;
+                }
+
+                // Otherwise it has to wait its turn in the queue like everything else
+                if (work_stealing) { local_queues[current_worker]->push(std::move(next)); }
+                else {
+                    queue.push(std::move(next));
+                }
+            }
         }
+        slot_chain = 0;
 
-        // Return the type
-        // If you're wondering why all the ridiculousness, it's because priority queue is not as feature complete as it
-        // should be its 'top' method returns a const reference (which we can't use to move a unique pointer)
-        std::unique_ptr<ReactionTask> task(
-            std::move(const_cast<std::unique_ptr<ReactionTask>&>(queue.top())));  // NOLINT
-        queue.pop();
+        auto task = work_stealing ? get_stealing_task() : queue.pop();
+
+        // If there is nothing in the queues, a continuation waiting in another thread's slot is better than idling
+        for (size_t i = 1; !task && i < slots.size(); ++i) {
+            task.reset(slots[(current_worker + i) % slots.size()].exchange(nullptr));
+        }
 
         return task;
     }
+
+    bool TaskScheduler::is_current() const {
+        return current_scheduler == this;
+    }
+
+    std::unique_ptr<ReactionTask> TaskScheduler::get_stealing_task() {
+
+        TaskQueue& local = *local_queues[current_worker];
+
+        // Take the more important of the tasks at the front of our own and the shared queue, ties go to the shared queue
+        // as anything in our own queue was submitted by a task that was itself run after the shared task was queued
+        TaskQueue& first  = local.top_priority() > queue.top_priority() ? local : queue;
+        TaskQueue& second = &first == &local ? queue : local;
+
+        auto task = first.pop();
+        if (!task) { task = second.pop(); }
+        if (task) { return task; }
+
+        // We have nothing to do ourselves, try to steal from the other pool threads
+        for (size_t i = 1; i < local_queues.size(); ++i) {
+            task = local_queues[(current_worker + i) % local_queues.size()]->pop();
+            if (task) { return task; }
+        }
+
+        return nullptr;
+    }
+
+    std::unique_ptr<ReactionTask> TaskScheduler::get_task() {
+
+        // Work out which local queue belongs to this thread the first time it asks us for a task
+        if (current_scheduler != this) {
+            current_scheduler = this;
+            current_worker    = next_worker++ % worker_count;
+        }
+
+        while (true) {
+
+            // Try to get a task without waiting
+            auto task = get_next_task();
+            if (task) {
+                --queued;
+                return task;
+            }
+
+            // Spin and then yield for a while in case a new task turns up soon, as that is much faster than sleeping
+            for (size_t i = 0; queued == 0 && running && i < spin_count + yield_count; ++i) {
+                if (i < spin_count) {
+                    cpu_relax();
+                }
+                else {
+                    std::this_thread::yield();
+                }
+            }
+
+            // Obtain the lock
+            std::unique_lock<std::mutex> lock(mutex);
+
+            // Let submitters know that they need to wake us up
+            ++sleeping;
+
+            // While there is nothing in any of our queues
+            while (queued == 0) {
+
+                // If the queue is empty we either wait or shutdown
+                if (!running) {
+                    --sleeping;
+
+                    // Notify any other threads that might be waiting on this condition
+                    condition.notify_all();
+
+                    // Return a nullptr to signify there is nothing on the queue
+                    return nullptr;
+                }
+
+                // Wait for something to happen!
+                condition.wait(lock);
+            }
+
+            --sleeping;
+        }
+    }
 }  // namespace threading
 }  // namespace NUClear
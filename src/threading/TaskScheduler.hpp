@@ -29,7 +29,9 @@
 #include <typeindex>
 #include <vector>
 
+#include "../util/platform.hpp"
 #include "Reaction.hpp"
+#include "TaskQueue.hpp"
 
 namespace NUClear {
 namespace threading {
@@ -66,9 +68,20 @@ namespace threading {
     class TaskScheduler {
     public:
         /**
-         * @brief Constructs a new TaskScheduler instance, and builds the nullptr sync queue.
+         * @brief Constructs a new TaskScheduler instance.
+         *
+         * @param thread_count      the number of pool threads that will be taking tasks from this scheduler
+         * @param work_stealing     if each pool thread should keep its own queue and steal work from the others
+         * @param spin_count        how many times an idle thread polls for a new task before it starts yielding
+         * @param yield_count       how many times an idle thread yields while polling for a new task before it sleeps
+         * @param continuation_slot if a pool thread should run the first task it submits as soon as its task is done
          */
-        TaskScheduler();
+        TaskScheduler(size_t thread_count    = 1,
+                      bool work_stealing     = false,
+                      size_t spin_count      = 0,
+                      size_t yield_count     = 0,
+                      bool continuation_slot = false);
+        ~TaskScheduler();
 
         /**
          * @brief
@@ -84,11 +97,26 @@ namespace threading {
          *  This method submits a new task to the scheduler. This task will then be sorted into the appropriate
          *  queue based on it's sync type and priority. It will then wait there until it is removed by a thread to
          *  be processed.
+         *  When work stealing is enabled and this is called from one of this scheduler's pool threads, the task is
+         *  placed on that thread's own queue rather than the shared queue.
+         *  When the continuation slot is enabled and this is called from one of this scheduler's pool threads, the
+         *  task is placed in that thread's slot if it is empty, so it can be run by that thread when it is next free.
          *
          * @param task  the task to be executed
          */
         void submit(std::unique_ptr<ReactionTask>&& task);
 
+        /**
+         * @brief Submit a group of new tasks to be executed to the Scheduler in a single operation.
+         *
+         * @details
+         *  The tasks are queued in the same way as individually submitted tasks, but waiting threads are only
+         *  signalled once for the whole group, and no more threads are woken than there are tasks to run.
+         *
+         * @param tasks the tasks to be executed
+         */
+        void submit(std::vector<std::unique_ptr<ReactionTask>>&& tasks);
+
         /**
          * @brief Get a task object to be executed by a thread.
          *
@@ -96,20 +124,83 @@ namespace threading {
          *  This method will get a task object to be executed from the queue. It will block until such a time as a
          *  task is available to be executed. For example, if a task with a paticular sync type was out, then this
          *  thread would block until that sync type was no longer out, and then it would take a task.
+         *  When work stealing is enabled the thread will take the more important of the tasks at the front of its own
+         *  queue and the shared queue, and if both are empty it will try to steal a task from the other threads.
+         *  When the continuation slot is enabled the task in this thread's slot is run first, unless a more important
+         *  task is waiting. If there is nothing else to do the thread will take a task from another thread's slot.
+         *  If there is nothing to do the thread will first spin and then yield while polling for a new task, and only
+         *  once both of those budgets are used up will it sleep until it is woken by a submit.
          *
          * @return the task which has been given to be executed
          */
         std::unique_ptr<ReactionTask> get_task();
 
+        /**
+         * @brief Checks if the calling thread is one of the threads that takes its tasks from this scheduler.
+         *
+         * @return true if the calling thread gets its tasks from this scheduler
+         */
+        bool is_current() const;
+
     private:
+        /**
+         * @brief Puts a task into the continuation slot or queue that it belongs in.
+         *
+         * @param task the task to queue
+         */
+        void enqueue(std::unique_ptr<ReactionTask>&& task);
+
+        /**
+         * @brief Gets the next task for a pool thread from its continuation slot or the queues, without waiting.
+         *
+         * @return the task to execute or nullptr if no task could be found anywhere
+         */
+        std::unique_ptr<ReactionTask> get_next_task();
+
+        /**
+         * @brief Gets a task for a work stealing pool thread, from its own queue, the shared queue or another thread.
+         *
+         * @return the task to execute or nullptr if no task could be found anywhere
+         */
+        std::unique_ptr<ReactionTask> get_stealing_task();
+
         /// @brief if the scheduler is running or is shut down
         volatile bool running;
-        /// @brief our queue which sorts tasks by priority
-        std::priority_queue<std::unique_ptr<ReactionTask>> queue;
-        /// @brief the mutex which our threads synchronize their access to this object
+        /// @brief if pool threads use their own queues and steal from each other
+        const bool work_stealing;
+        /// @brief if pool threads keep the first task they submit to run as soon as they are free
+        const bool continuation_slot;
+        /// @brief the number of pool threads that take tasks from this scheduler
+        const size_t worker_count;
+        /// @brief the task each pool thread will run next if the continuation slot is enabled
+        std::vector<std::atomic<ReactionTask*>> slots;
+        /// @brief how many continuations a pool thread runs in a row before it goes back to the queue
+        static constexpr size_t max_slot_chain = 3;
+        /// @brief the shared queue that tasks are submitted to from outside of the pool
+        TaskQueue queue;
+        /// @brief the per thread queues that are used when work stealing is enabled
+        std::vector<std::unique_ptr<TaskQueue>> local_queues;
+        /// @brief the source for assigning local queues to pool threads
+        std::atomic<size_t> next_worker;
+        /// @brief the total number of tasks waiting in all of the queues
+        std::atomic<size_t> queued;
+        /// @brief the number of threads that are asleep waiting on the condition for a task
+        std::atomic<size_t> sleeping;
+        /// @brief how many times an idle thread polls for a task before it starts yielding
+        const size_t spin_count;
+        /// @brief how many times an idle thread yields while polling for a task before it sleeps
+        const size_t yield_count;
+        /// @brief the mutex that idle threads synchronize on while waiting for a task
         std::mutex mutex;
         /// @brief the condition object that threads wait on if they can't get a task
         std::condition_variable condition;
+
+        /// @brief the scheduler that the current thread is a pool thread for (or nullptr if it is not one)
+        static ATTRIBUTE_TLS TaskScheduler* current_scheduler;
+        /// @brief the index of the local queue and continuation slot that belong to the current thread
+        static ATTRIBUTE_TLS size_t current_worker;
+        /// @brief how many continuations the current thread has run in a row
+        static ATTRIBUTE_TLS size_t slot_chain;
     };
 
 }  // namespace threading
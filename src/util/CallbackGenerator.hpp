@@ -89,9 +89,10 @@ namespace util {
                     return std::make_pair(0, threading::ReactionTask::TaskFunction());
                 }
 
-                // We have to make a copy of the callback because the "this" variable can go out of scope
-                auto c = callback;
-                return std::make_pair(DSL::priority(r), [c, data](std::unique_ptr<threading::ReactionTask>&& task) {
+                // This generator lives in the reaction which outlives its tasks, so they can share our callback rather
+                // than each having their own copy
+                auto c = &callback;
+                auto task_function = [c, data = std::move(data)](std::unique_ptr<threading::ReactionTask>&& task) {
                     // Check if we are going to reschedule
                     task = DSL::reschedule(std::move(task));
 
@@ -101,22 +102,33 @@ namespace util {
                         // Update our thread's priority to the correct level
                         update_current_thread_priority(task->priority);
 
-                        // Record our start time
-                        task->stats->started = clock::now();
+                        // Record our start time if we are collecting statistics
+                        if (task->stats) { task->stats->started = clock::now(); }
 
                         // We have to catch any exceptions
                         try {
                             // We call with only the relevant arguments to the passed function
-                            util::apply_relevant(c, std::move(data));
+                            util::apply_relevant(*c, std::move(data));
                         }
                         catch (...) {
 
                             // Catch our exception if it happens
-                            task->stats->exception = std::current_exception();
+                            if (task->stats) { task->stats->exception = std::current_exception(); }
                         }
 
-                        // Our finish time
-                        task->stats->finished = clock::now();
+                        // Our finish time, we only need it for our statistics or to check our deadline
+                        if (task->stats || task->deadline != clock::time_point::max()) {
+                            clock::time_point finished = clock::now();
+
+                            // Count it if we finished after our deadline
+                            uint64_t missed = finished > task->deadline ? ++task->parent.missed_deadlines
+                                                                        : task->parent.missed_deadlines.load();
+
+                            if (task->stats) {
+                                task->stats->finished         = finished;
+                                task->stats->missed_deadlines = missed;
+                            }
+                        }
 
                         // Run our postconditions
                         DSL::postcondition(*task);
@@ -125,14 +137,16 @@ namespace util {
                         --task->parent.active_tasks;
 
                         // Emit our reaction statistics if it wouldn't cause a loop
-                        if (task->emit_stats) {
+                        if (task->emit_stats && task->stats) {
                             PowerPlant::powerplant->emit<dsl::word::emit::Direct>(task->stats);
                         }
                     }
 
                     // Return our task
                     return std::move(task);
-                });
+                };
+
+                return std::make_pair(DSL::priority(r), std::move(task_function));
             }
         }
 
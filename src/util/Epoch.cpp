@@ -0,0 +1,205 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "Epoch.hpp"
+
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "platform.hpp"
+
+namespace NUClear {
+namespace util {
+
+    namespace {
+
+        /// The epoch that a reader announces while it holds a Guard, or zero when it is not reading
+        struct Slot {
+            std::atomic<uint64_t> epoch{0};
+            std::atomic<bool> in_use{true};
+            int depth  = 0;
+            Slot* next = nullptr;
+        };
+
+        /// An object that has been retired and the epoch it was retired in
+        struct Retired {
+            uint64_t epoch;
+            std::function<void()> deleter;
+        };
+
+        /// The shared state, which is never destroyed so that threads can still read while the program is exiting
+        struct State {
+            std::atomic<uint64_t> epoch{1};
+
+            /// Every slot that has been made, slots are never removed so this can be walked without locking
+            std::atomic<Slot*> slots{nullptr};
+
+            /// Objects retired by threads that exited before they could be reclaimed
+            std::mutex orphans_mutex;
+            std::vector<Retired> orphans;
+            std::atomic<size_t> orphan_count{0};
+
+            /// Finds a slot that is not being used by any thread, or makes a new one
+            Slot* acquire() {
+                for (Slot* slot = slots.load(); slot != nullptr; slot = slot->next) {
+                    bool free = false;
+                    if (slot->in_use.compare_exchange_strong(free, true)) { return slot; }
+                }
+                Slot* slot = new Slot();
+                slot->next = slots.load();
+                while (!slots.compare_exchange_weak(slot->next, slot)) {}
+                return slot;
+            }
+
+            /// The oldest epoch any reader is currently reading in
+            uint64_t oldest_reader() {
+                uint64_t oldest = std::numeric_limits<uint64_t>::max();
+                for (Slot* slot = slots.load(); slot != nullptr; slot = slot->next) {
+                    uint64_t e = slot->epoch.load();
+                    if (e != 0 && e < oldest) { oldest = e; }
+                }
+                return oldest;
+            }
+        };
+
+        State& state() {
+            static State* state = new State();
+            return *state;
+        }
+
+        /// This thread's slot, or nullptr if it hasn't read anything yet
+        ATTRIBUTE_TLS Slot* local_slot = nullptr;
+        /// If this thread has exited and given its slot back
+        ATTRIBUTE_TLS bool slot_returned = false;
+
+        /// Holds this thread's slot and gives it back for another thread to use when this thread exits
+        struct SlotOwner {
+            SlotOwner() : slot(state().acquire()) {}
+            ~SlotOwner() {
+                local_slot    = nullptr;
+                slot_returned = true;
+                slot->in_use.store(false);
+            }
+            Slot* slot;
+        };
+
+        Slot& get_slot() {
+            if (local_slot == nullptr) {
+                if (!slot_returned) {
+                    static thread_local SlotOwner owner;
+                    local_slot = owner.slot;
+                }
+                // If we read again while exiting we can no longer give a slot back, so we keep this one forever
+                else {
+                    local_slot = state().acquire();
+                }
+            }
+            return *local_slot;
+        }
+
+        /// Moves everything that no reader can still see out of a list of retired objects
+        void take_reclaimable(std::vector<Retired>& retired, uint64_t oldest, std::vector<Retired>& reclaimable) {
+            auto it = retired.begin();
+            while (it != retired.end()) {
+                if (it->epoch < oldest) {
+                    reclaimable.push_back(std::move(*it));
+                    it = retired.erase(it);
+                }
+                else {
+                    ++it;
+                }
+            }
+        }
+
+        /// If this thread has exited and handed its retired objects over to the orphans
+        ATTRIBUTE_TLS bool retired_returned = false;
+
+        /// The objects this thread has retired which may still be seen by a reader
+        struct RetiredList {
+            std::vector<Retired> list;
+            ~RetiredList() {
+                retired_returned = true;
+                if (!list.empty()) {
+                    State& s = state();
+                    std::lock_guard<std::mutex> lock(s.orphans_mutex);
+                    for (auto& r : list) {
+                        s.orphans.push_back(std::move(r));
+                    }
+                    s.orphan_count = s.orphans.size();
+                }
+            }
+        };
+    }  // namespace
+
+    Epoch::Guard::Guard() : active(true) {
+        Slot& slot = get_slot();
+        if (slot.depth++ == 0) { slot.epoch.store(state().epoch.load()); }
+    }
+
+    Epoch::Guard::Guard(Guard&& other) noexcept : active(other.active) {
+        other.active = false;
+    }
+
+    Epoch::Guard::~Guard() {
+        if (active) {
+            Slot& slot = *local_slot;
+            if (--slot.depth == 0) { slot.epoch.store(0); }
+        }
+    }
+
+    void Epoch::retire(std::function<void()>&& deleter) {
+        State& s = state();
+
+        // Readers that started before this can still see the object, readers that start after can't
+        uint64_t retired_epoch = s.epoch.fetch_add(1);
+
+        // Anything retired before the oldest reader started can no longer be seen by anyone
+        uint64_t oldest = s.oldest_reader();
+        std::vector<Retired> reclaimable;
+
+        // Objects are kept by the thread that retired them so retiring doesn't need to lock
+        if (!retired_returned) {
+            static thread_local RetiredList retired;
+            retired.list.push_back(Retired{retired_epoch, std::move(deleter)});
+            take_reclaimable(retired.list, oldest, reclaimable);
+        }
+        // If we are exiting we can't keep them any more so they go to the orphans
+        else {
+            std::lock_guard<std::mutex> lock(s.orphans_mutex);
+            s.orphans.push_back(Retired{retired_epoch, std::move(deleter)});
+            s.orphan_count = s.orphans.size();
+        }
+
+        // Clean up after any threads that have exited
+        if (s.orphan_count.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(s.orphans_mutex);
+            take_reclaimable(s.orphans, oldest, reclaimable);
+            s.orphan_count = s.orphans.size();
+        }
+
+        // Destroy the objects outside of our lists as destroying them may retire more objects
+        for (auto& r : reclaimable) {
+            r.deleter();
+        }
+    }
+
+}  // namespace util
+}  // namespace NUClear
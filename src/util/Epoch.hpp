@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_EPOCH_HPP
+#define NUCLEAR_UTIL_EPOCH_HPP
+
+#include <cstdint>
+#include <functional>
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * @brief Epoch based reclamation for data that is read without locks and replaced by publishing a new copy.
+     *
+     * @details
+     *  Readers hold a Guard while they use shared data. This announces the epoch they started reading in and costs
+     *  one store on entry and one on exit, with no locks or reference counting. Writers publish a new copy of the data
+     *  and then retire the old one. A retired object is only destroyed once every reader that could still be looking
+     *  at it has released its Guard. Each thread keeps the objects it retired and reclaims them the next time it
+     *  retires something, so retiring takes no locks and writers never wait for readers (a reader may even write
+     *  while it holds a Guard).
+     */
+    class Epoch {
+    public:
+        /**
+         * @brief Marks the current thread as reading epoch protected data for as long as it exists.
+         *
+         * @details
+         *  Guards can be nested, the outermost one decides when the thread stops reading.
+         */
+        class Guard {
+        public:
+            Guard();
+            ~Guard();
+
+            /// Moving a guard hands the protection over to the new guard
+            Guard(Guard&& other) noexcept;
+
+            Guard(const Guard&) = delete;
+            Guard& operator=(const Guard&) = delete;
+            Guard& operator=(Guard&&) = delete;
+
+        private:
+            /// if this guard is still protecting the thread (false once it has been moved from)
+            bool active;
+        };
+
+        /**
+         * @brief Destroys an object once no reader can still be using it.
+         *
+         * @details
+         *  The object must already have been unpublished, so that new readers can no longer find it.
+         *
+         * @param deleter the function that destroys the object
+         */
+        static void retire(std::function<void()>&& deleter);
+
+        /**
+         * @brief Deletes a pointer once no reader can still be using it.
+         *
+         * @param ptr the pointer to delete, which must already have been unpublished
+         */
+        template <typename T>
+        static void retire(const T* ptr) {
+            retire([ptr] { delete ptr; });
+        }
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_EPOCH_HPP
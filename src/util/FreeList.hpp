@@ -0,0 +1,204 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_FREELIST_HPP
+#define NUCLEAR_UTIL_FREELIST_HPP
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * @brief A per thread free list of fixed size memory blocks with a shared depot for moving blocks between threads.
+     *
+     * @details
+     *  Each thread keeps its own list of free blocks so allocating and freeing does not need any locks. Blocks are
+     *  often freed on a different thread to the one that allocated them (a task is created by the emitting thread and
+     *  destroyed by the pool thread that ran it) so when a thread's list grows too long it hands a batch of blocks to
+     *  a shared depot, and when a thread's list is empty it takes a batch back from the depot before falling back to
+     *  the global heap. Only moving a batch to or from the depot takes a lock.
+     *
+     * @tparam Size the size in bytes of the objects that will be stored in the blocks
+     */
+    template <size_t Size>
+    class FreeList {
+    private:
+        struct Node {
+            Node* next;
+        };
+
+        /// @brief the size of each block, large enough to hold a node and keeping every block suitably aligned
+        static constexpr size_t block_size =
+            ((Size < sizeof(Node) ? sizeof(Node) : Size) + alignof(std::max_align_t) - 1)
+            & ~(alignof(std::max_align_t) - 1);
+
+        /// @brief the number of blocks moved to or from the depot at a time
+        static constexpr size_t batch_size = 32;
+
+        /// @brief the blocks that threads have handed back, held as chains of up to batch_size blocks
+        struct Depot {
+            std::mutex mutex;
+            std::vector<std::pair<Node*, size_t>> batches;
+        };
+
+        static Depot& depot() {
+            // This is deliberately never destroyed so blocks can still be returned while the program is exiting
+            static Depot* depot = new Depot();
+            return *depot;
+        }
+
+        /// @brief true once this thread's cache has been destroyed, after which we fall back to the global heap
+        static bool& cache_destroyed() {
+            static thread_local bool destroyed = false;
+            return destroyed;
+        }
+
+        struct Cache {
+            Node* head  = nullptr;
+            size_t size = 0;
+
+            ~Cache() {
+                while (size > 0) {
+                    release(size < batch_size ? size : batch_size);
+                }
+                cache_destroyed() = true;
+            }
+
+            /// Moves count blocks from this thread's list to the depot
+            void release(size_t count) {
+                Node* first = head;
+                Node* last  = head;
+                for (size_t i = 1; i < count; ++i) {
+                    last = last->next;
+                }
+                head       = last->next;
+                last->next = nullptr;
+                size -= count;
+
+                Depot& d = depot();
+                std::lock_guard<std::mutex> lock(d.mutex);
+                d.batches.emplace_back(first, count);
+            }
+
+            /// Takes a batch of blocks from the depot if there are any there
+            void refill() {
+                Depot& d = depot();
+                std::lock_guard<std::mutex> lock(d.mutex);
+                if (!d.batches.empty()) {
+                    head = d.batches.back().first;
+                    size = d.batches.back().second;
+                    d.batches.pop_back();
+                }
+            }
+        };
+
+        static Cache& cache() {
+            static thread_local Cache cache;
+            return cache;
+        }
+
+    public:
+        /**
+         * @brief Allocates a block of at least Size bytes.
+         *
+         * @return a pointer to the allocated block
+         */
+        static void* allocate() {
+            if (!cache_destroyed()) {
+                Cache& c = cache();
+                if (c.head == nullptr) { c.refill(); }
+                if (c.head != nullptr) {
+                    Node* node = c.head;
+                    c.head     = node->next;
+                    --c.size;
+                    return node;
+                }
+            }
+            return ::operator new(block_size);
+        }
+
+        /**
+         * @brief Returns a block that was allocated by allocate so it can be reused.
+         *
+         * @details
+         *  The block may be returned from any thread, not just the one that allocated it.
+         *
+         * @param ptr the block to return
+         */
+        static void deallocate(void* ptr) {
+            if (cache_destroyed()) {
+                ::operator delete(ptr);
+                return;
+            }
+
+            Cache& c   = cache();
+            Node* node = static_cast<Node*>(ptr);
+            node->next = c.head;
+            c.head     = node;
+            if (++c.size >= 2 * batch_size) { c.release(batch_size); }
+        }
+    };
+
+    /**
+     * @brief A standard allocator that takes single objects from a FreeList, for use with std::allocate_shared.
+     *
+     * @details
+     *  Arrays and over aligned types are allocated from the global heap as the free list only holds single objects
+     *  that are aligned for normal types.
+     *
+     * @tparam T the type of object to allocate
+     */
+    template <typename T>
+    struct FreeListAllocator {
+        using value_type = T;
+
+        FreeListAllocator() = default;
+        template <typename U>
+        FreeListAllocator(const FreeListAllocator<U>&) {}
+
+        T* allocate(size_t n) {
+            return static_cast<T*>(n == 1 && alignof(T) <= alignof(std::max_align_t) ? FreeList<sizeof(T)>::allocate()
+                                                                                       : ::operator new(n * sizeof(T)));
+        }
+
+        void deallocate(T* ptr, size_t n) {
+            if (n == 1 && alignof(T) <= alignof(std::max_align_t)) { FreeList<sizeof(T)>::deallocate(ptr); }
+            else {
+                ::operator delete(ptr);
+            }
+        }
+
+        template <typename U>
+        bool operator==(const FreeListAllocator<U>&) const {
+            return true;
+        }
+        template <typename U>
+        bool operator!=(const FreeListAllocator<U>&) const {
+            return false;
+        }
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_FREELIST_HPP
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_LOCKFREEQUEUE_HPP
+#define NUCLEAR_UTIL_LOCKFREEQUEUE_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * @brief A bounded multi producer multi consumer FIFO queue that does not use any locks.
+     *
+     * @details
+     *  Each slot in the ring holds a sequence number which tells producers and consumers whose turn it is to use that
+     *  slot. Producers and consumers claim a position by advancing the tail/head index with a compare and swap and then
+     *  publish their change to the slot by updating its sequence number. When the queue is full push will fail rather
+     *  than block, so the caller can decide what to do with the item.
+     *
+     * @tparam T        the type of the items stored in the queue, it should be cheap to copy (e.g. a pointer)
+     * @tparam Capacity the number of items the queue can hold, must be a power of two
+     */
+    template <typename T, size_t Capacity>
+    class LockFreeQueue {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "The capacity must be a power of two");
+
+    public:
+        LockFreeQueue() : head(), tail() {
+            for (size_t i = 0; i < Capacity; ++i) {
+                cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        LockFreeQueue(const LockFreeQueue&) = delete;
+        LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+        /**
+         * @brief Adds an item to the back of the queue.
+         *
+         * @param value the item to add
+         *
+         * @return true if the item was added, false if the queue was full
+         */
+        bool push(const T& value) {
+            size_t pos = tail.load(std::memory_order_relaxed);
+            Cell* cell;
+            while (true) {
+                cell         = &cells[pos & (Capacity - 1)];
+                size_t seq   = cell->sequence.load(std::memory_order_acquire);
+                intptr_t dif = intptr_t(seq) - intptr_t(pos);
+
+                // This slot is free for us to claim
+                if (dif == 0) {
+                    if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) { break; }
+                }
+                // The slot still holds an item from a lap ago so we are full
+                else if (dif < 0) {
+                    return false;
+                }
+                // Someone else claimed this slot first, try again from the new tail
+                else {
+                    pos = tail.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->data = value;
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Removes the item at the front of the queue.
+         *
+         * @param value where to store the removed item
+         *
+         * @return true if an item was removed, false if the queue was empty
+         */
+        bool pop(T& value) {
+            size_t pos = head.load(std::memory_order_relaxed);
+            Cell* cell;
+            while (true) {
+                cell         = &cells[pos & (Capacity - 1)];
+                size_t seq   = cell->sequence.load(std::memory_order_acquire);
+                intptr_t dif = intptr_t(seq) - intptr_t(pos + 1);
+
+                // This slot has been published for us to take
+                if (dif == 0) {
+                    if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) { break; }
+                }
+                // Nothing has been published in this slot yet so we are empty
+                else if (dif < 0) {
+                    return false;
+                }
+                // Someone else took this slot first, try again from the new head
+                else {
+                    pos = head.load(std::memory_order_relaxed);
+                }
+            }
+
+            value = cell->data;
+            cell->sequence.store(pos + Capacity, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Checks if the queue is empty.
+         *
+         * @details
+         *  Items that a producer has claimed a slot for but not yet finished publishing count as being in the queue.
+         *
+         * @return true if there are no items in the queue
+         */
+        bool empty() const {
+            return head.load() >= tail.load();
+        }
+
+    private:
+        struct Cell {
+            std::atomic<size_t> sequence;
+            T data;
+        };
+
+        /// @brief An index that is padded out to fill a cache line so producers and consumers don't share one
+        struct PaddedIndex : public std::atomic<size_t> {
+            PaddedIndex() : std::atomic<size_t>(0) {}
+            char padding[64 - sizeof(std::atomic<size_t>)];
+        };
+
+        /// @brief the index of the next item to be removed
+        PaddedIndex head;
+        /// @brief the index of the next slot to be filled
+        PaddedIndex tail;
+        /// @brief the ring of slots that hold the items
+        std::array<Cell, Capacity> cells;
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_LOCKFREEQUEUE_HPP
@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_SMALLFUNCTION_HPP
+#define NUCLEAR_UTIL_SMALLFUNCTION_HPP
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "FreeList.hpp"
+
+namespace NUClear {
+namespace util {
+
+    template <typename Signature, size_t Capacity>
+    class SmallFunction;
+
+    /**
+     * @brief A move only, type erased callable that stores small callables inside itself rather than on the heap.
+     *
+     * @details
+     *  This fills the same role as std::function, but as it never has to copy the callable it holds it can hold move
+     *  only types, and it has a much larger buffer for storing the callable inline. Callables that do not fit in the
+     *  buffer (or that could throw while being moved) are stored in a block from a per thread FreeList instead.
+     *
+     * @tparam R        the return type of the callable
+     * @tparam Args     the argument types of the callable
+     * @tparam Capacity the number of bytes available for storing callables inline
+     */
+    template <typename R, typename... Args, size_t Capacity>
+    class SmallFunction<R(Args...), Capacity> {
+        static_assert(Capacity >= sizeof(void*), "The buffer must be able to hold a pointer to a larger callable");
+
+    private:
+        /// @brief the operations that are needed for the type of callable that is stored
+        struct Operations {
+            R (*invoke)(void* storage, Args&&... args);
+            void (*move)(void* from, void* to) noexcept;
+            void (*destroy)(void* storage) noexcept;
+        };
+
+        /// @brief true if a callable of type F is stored in the buffer, otherwise the buffer holds a pointer to it
+        template <typename F>
+        using is_inline = std::integral_constant<bool,
+                                                 sizeof(F) <= Capacity
+                                                     && alignof(F) <= alignof(std::max_align_t)
+                                                     && std::is_nothrow_move_constructible<F>::value>;
+
+        template <typename F, bool = is_inline<F>::value>
+        struct Storage {
+            template <typename T>
+            static void create(void* storage, T&& f) {
+                new (storage) F(std::forward<T>(f));
+            }
+            static F& get(void* storage) {
+                return *static_cast<F*>(storage);
+            }
+            static void move(void* from, void* to) noexcept {
+                new (to) F(std::move(get(from)));
+                get(from).~F();
+            }
+            static void destroy(void* storage) noexcept {
+                get(storage).~F();
+            }
+        };
+
+        template <typename F>
+        struct Storage<F, false> {
+            template <typename T>
+            static void create(void* storage, T&& f) {
+                void* block = allocate();
+                try {
+                    *static_cast<F**>(storage) = new (block) F(std::forward<T>(f));
+                }
+                catch (...) {
+                    deallocate(block);
+                    throw;
+                }
+            }
+            static F& get(void* storage) {
+                return **static_cast<F**>(storage);
+            }
+            static void move(void* from, void* to) noexcept {
+                *static_cast<F**>(to) = *static_cast<F**>(from);
+            }
+            static void destroy(void* storage) noexcept {
+                get(storage).~F();
+                deallocate(&get(storage));
+            }
+
+        private:
+            // Over aligned callables can't come from the free list as its blocks are only aligned for normal types
+            static void* allocate() {
+                return alignof(F) <= alignof(std::max_align_t) ? FreeList<sizeof(F)>::allocate()
+                                                                : ::operator new(sizeof(F));
+            }
+            static void deallocate(void* block) {
+                if (alignof(F) <= alignof(std::max_align_t)) { FreeList<sizeof(F)>::deallocate(block); }
+                else {
+                    ::operator delete(block);
+                }
+            }
+        };
+
+        template <typename F>
+        static const Operations* operations() {
+            static const Operations ops = {
+                [](void* storage, Args&&... args) -> R {
+                    return Storage<F>::get(storage)(std::forward<Args>(args)...);
+                },
+                &Storage<F>::move,
+                &Storage<F>::destroy,
+            };
+            return &ops;
+        }
+
+    public:
+        SmallFunction() noexcept : ops(nullptr) {}
+
+        SmallFunction(std::nullptr_t) noexcept : ops(nullptr) {}
+
+        template <typename F,
+                  typename = std::enable_if_t<!std::is_same<std::decay_t<F>, SmallFunction>::value
+                                              && !std::is_same<std::decay_t<F>, std::nullptr_t>::value>>
+        SmallFunction(F&& f) : ops(nullptr) {
+            Storage<std::decay_t<F>>::create(&storage, std::forward<F>(f));
+            ops = operations<std::decay_t<F>>();
+        }
+
+        SmallFunction(SmallFunction&& other) noexcept : ops(other.ops) {
+            if (ops != nullptr) {
+                ops->move(&other.storage, &storage);
+                other.ops = nullptr;
+            }
+        }
+
+        SmallFunction& operator=(SmallFunction&& other) noexcept {
+            if (this != &other) {
+                reset();
+                if (other.ops != nullptr) {
+                    other.ops->move(&other.storage, &storage);
+                    ops       = other.ops;
+                    other.ops = nullptr;
+                }
+            }
+            return *this;
+        }
+
+        SmallFunction& operator=(std::nullptr_t) noexcept {
+            reset();
+            return *this;
+        }
+
+        SmallFunction(const SmallFunction&) = delete;
+        SmallFunction& operator=(const SmallFunction&) = delete;
+
+        ~SmallFunction() {
+            reset();
+        }
+
+        /**
+         * @brief Calls the stored callable.
+         *
+         * @throws std::bad_function_call if there is no callable stored
+         */
+        R operator()(Args... args) {
+            if (ops == nullptr) { throw std::bad_function_call(); }
+            return ops->invoke(&storage, std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Returns true if there is a callable stored.
+         */
+        explicit operator bool() const noexcept {
+            return ops != nullptr;
+        }
+
+    private:
+        /// @brief destroys the stored callable, leaving this empty
+        void reset() noexcept {
+            if (ops != nullptr) {
+                ops->destroy(&storage);
+                ops = nullptr;
+            }
+        }
+
+        /// @brief the buffer that holds the callable, or a pointer to it if it did not fit
+        typename std::aligned_storage<Capacity, alignof(std::max_align_t)>::type storage;
+        /// @brief the operations for the type of the stored callable, or nullptr if there isn't one
+        const Operations* ops;
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_SMALLFUNCTION_HPP
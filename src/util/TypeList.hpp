@@ -19,13 +19,26 @@
 #ifndef NUCLEAR_UTIL_TYPELIST_HPP
 #define NUCLEAR_UTIL_TYPELIST_HPP
 
+#include <atomic>
 #include <memory>
 #include <mutex>
+#include <utility>
 #include <vector>
 
+#include "Epoch.hpp"
+
 namespace NUClear {
 namespace util {
 
+    /**
+     * @brief A list of values for each key type that can be read without locking while it is being changed.
+     *
+     * @details
+     *  The list is never changed in place. Changes are made to a copy of the list which is then published for readers
+     *  to use, and the old list is destroyed once all of the readers that might still be looking at it have finished.
+     *  This lets emits iterate over the reactions for a type without any locks or reference counting while reactions
+     *  are being bound and unbound on other threads.
+     */
     template <typename MapID, typename Key, typename Value>
     class TypeList {
     private:
@@ -33,23 +46,114 @@ namespace util {
         TypeList() = delete;
         /// @brief Deleted destructor as this class is a static class.
         ~TypeList() = delete;
-        /// @brief the data variable where the data is stored for this map key.
-        static std::vector<Value> data;
+        /// @brief the current list for this map key, or nullptr if nothing has been added yet
+        static std::atomic<const std::vector<Value>*> data;
+        /// @brief held while making a new list so that concurrent changes are not lost
+        static std::mutex mutex;
+
+        /// @brief the list that is read before anything has been added
+        static const std::vector<Value>& empty_list() {
+            static const std::vector<Value> list;
+            return list;
+        }
 
     public:
+        /**
+         * @brief A read only view of the list as it was when the view was made, it stays valid as long as it exists.
+         */
+        class Snapshot {
+        public:
+            using const_iterator = typename std::vector<Value>::const_iterator;
+
+            Snapshot() : guard(), list(data.load()) {
+                if (list == nullptr) { list = &empty_list(); }
+            }
+
+            const_iterator begin() const {
+                return list->begin();
+            }
+            const_iterator end() const {
+                return list->end();
+            }
+            size_t size() const {
+                return list->size();
+            }
+            bool empty() const {
+                return list->empty();
+            }
+
+        private:
+            /// @brief stops the list being destroyed while we are looking at it, this must be created before we load it
+            Epoch::Guard guard;
+            /// @brief the list we are looking at
+            const std::vector<Value>* list;
+        };
+
         /**
          * @brief Gets the list that is stored in this type location
          *
-         * @return A reference to the vector stored in this location
+         * @return A snapshot of the list as it is now, later changes to the list will not be seen through it
+         */
+        static Snapshot get() {
+            return Snapshot();
+        }
+
+        /**
+         * @brief Adds a value to the end of the list
+         *
+         * @param value the value to add
+         */
+        static void add(const Value& value) {
+            const std::vector<Value>* old;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                old       = data.load();
+                auto next = old != nullptr ? new std::vector<Value>(*old) : new std::vector<Value>();
+                next->push_back(value);
+                data.store(next);
+            }
+            if (old != nullptr) { Epoch::retire(old); }
+        }
+
+        /**
+         * @brief Removes all of the values that match a predicate from the list
+         *
+         * @param predicate returns true for values that should be removed
+         *
+         * @return true if any values were removed
          */
-        static std::vector<Value>& get() {
-            return data;
+        template <typename Predicate>
+        static bool remove_if(Predicate&& predicate) {
+            const std::vector<Value>* old;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                old = data.load();
+                if (old == nullptr) { return false; }
+
+                auto next = new std::vector<Value>();
+                next->reserve(old->size());
+                for (const auto& v : *old) {
+                    if (!predicate(v)) { next->push_back(v); }
+                }
+
+                // If nothing matched there is nothing to publish
+                if (next->size() == old->size()) {
+                    delete next;
+                    return false;
+                }
+                data.store(next);
+            }
+            Epoch::retire(old);
+            return true;
         }
     };
 
     /// Initialize our type list data
     template <typename MapID, typename Key, typename Value>
-    std::vector<Value> TypeList<MapID, Key, Value>::data;
+    std::atomic<const std::vector<Value>*> TypeList<MapID, Key, Value>::data(nullptr);
+
+    template <typename MapID, typename Key, typename Value>
+    std::mutex TypeList<MapID, Key, Value>::mutex;
 
 }  // namespace util
 }  // namespace NUClear
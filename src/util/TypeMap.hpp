@@ -19,9 +19,10 @@
 #ifndef NUCLEAR_UTIL_TYPEMAP_HPP
 #define NUCLEAR_UTIL_TYPEMAP_HPP
 
+#include <atomic>
 #include <memory>
-#include <mutex>
-#include <vector>
+
+#include "Epoch.hpp"
 
 namespace NUClear {
 namespace util {
@@ -49,9 +50,8 @@ namespace util {
         /// @brief Deleted destructor as this class is a static class.
         ~TypeMap() = delete;
         /// @brief the data variable where the data is stored for this map key.
-
-        static std::shared_ptr<Value> data;
-        static std::mutex mutex;
+        /// @details each set publishes a new shared_ptr so readers can copy the current one without locking
+        static std::atomic<const std::shared_ptr<Value>*> data;
 
     public:
         /**
@@ -61,12 +61,9 @@ namespace util {
          */
         static void set(std::shared_ptr<Value> d) {
 
-            // Do this once G++ supports it
-            // std::atomic_store_explicit(&data, d, std::memory_order_relaxed);
-
-            // Lock a mutex and set our data
-            std::lock_guard<std::mutex> lock(mutex);
-            data = std::move(d);
+            // Publish the new value and let go of the old one once no reader can still be copying it
+            auto old = data.exchange(new std::shared_ptr<Value>(std::move(d)));
+            if (old != nullptr) { Epoch::retire(old); }
         }
 
         /**
@@ -76,24 +73,16 @@ namespace util {
          */
         static std::shared_ptr<Value> get() {
 
-            // TODO do this when gcc supports it
-            // std::atomic_load_explicit(&data, std::memory_order_relaxed);
-
-            std::shared_ptr<Value> d;
-            {
-                std::lock_guard<std::mutex> lock(mutex);
-                d = data;
-            }
-
-            return d;
+            // Our guard stops the shared_ptr we load being destroyed while we copy it
+            Epoch::Guard guard;
+            auto d = data.load();
+            return d != nullptr ? *d : nullptr;
         }
     };
 
     /// Initialize our shared_ptr data
     template <typename MapID, typename Key, typename Value>
-    std::shared_ptr<Value> TypeMap<MapID, Key, Value>::data;
-    template <typename MapID, typename Key, typename Value>
-    std::mutex TypeMap<MapID, Key, Value>::mutex;
+    std::atomic<const std::shared_ptr<Value>*> TypeMap<MapID, Key, Value>::data(nullptr);
 
 }  // namespace util
 }  // namespace NUClear
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "cpu_affinity.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "platform.hpp"
+
+#if defined(__linux__)
+#    include <pthread.h>
+#    include <sched.h>
+#endif
+
+namespace NUClear {
+namespace util {
+
+#if defined(__linux__)
+
+    namespace {
+        /**
+         * @brief Parses a list of cpus in the kernel's list format (e.g. 0-3,8,10-11)
+         *
+         * @param list the text of the list
+         *
+         * @return the ids of all the cpus in the list
+         */
+        std::vector<int> parse_cpu_list(const std::string& list) {
+            std::vector<int> cpus;
+
+            std::stringstream stream(list);
+            std::string range;
+            while (std::getline(stream, range, ',')) {
+                auto dash = range.find('-');
+                try {
+                    int first = std::stoi(range.substr(0, dash));
+                    int last  = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+                    for (int cpu = first; cpu <= last; ++cpu) {
+                        cpus.push_back(cpu);
+                    }
+                }
+                // Ignore anything that isn't a number (such as the trailing newline)
+                catch (const std::logic_error&) {
+                }
+            }
+
+            return cpus;
+        }
+
+        /**
+         * @brief Reads the first line of a file in sysfs
+         *
+         * @param path the path to the file
+         *
+         * @return the first line of the file, or an empty string if it could not be read
+         */
+        std::string read_line(const std::string& path) {
+            std::ifstream file(path);
+            std::string line;
+            std::getline(file, line);
+            return line;
+        }
+    }  // namespace
+
+    std::vector<std::vector<int>> physical_cores() {
+
+        const std::string base = "/sys/devices/system/cpu/";
+
+        // Group the online cpus by the package and core they live on
+        std::map<std::pair<int, int>, std::vector<int>> cores;
+        for (int cpu : parse_cpu_list(read_line(base + "online"))) {
+            std::string topology = base + "cpu" + std::to_string(cpu) + "/topology/";
+            std::string package  = read_line(topology + "physical_package_id");
+            std::string core     = read_line(topology + "core_id");
+
+            try {
+                cores[std::make_pair(std::stoi(package), std::stoi(core))].push_back(cpu);
+            }
+            // If we can't read the topology for this cpu treat it as its own core
+            catch (const std::logic_error&) {
+                cores[std::make_pair(-1, cpu)].push_back(cpu);
+            }
+        }
+
+        // Order the cores by their first logical cpu so the numbering is what people expect
+        std::vector<std::vector<int>> result;
+        for (auto& core : cores) {
+            result.push_back(core.second);
+        }
+        std::sort(result.begin(), result.end());
+
+        return result;
+    }
+
+    bool set_current_thread_affinity(const std::vector<int>& cpus) {
+
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu : cpus) {
+            if (cpu >= 0 && cpu < CPU_SETSIZE) { CPU_SET(cpu, &set); }
+        }
+
+        return CPU_COUNT(&set) > 0 && pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+    }
+
+#elif defined(_WIN32)
+
+    std::vector<std::vector<int>> physical_cores() {
+        // TODO use GetLogicalProcessorInformation to find the cores on windows
+        return std::vector<std::vector<int>>();
+    }
+
+    bool set_current_thread_affinity(const std::vector<int>& cpus) {
+
+        DWORD_PTR mask = 0;
+        for (int cpu : cpus) {
+            if (cpu >= 0 && cpu < int(sizeof(DWORD_PTR) * 8)) { mask |= DWORD_PTR(1) << cpu; }
+        }
+
+        return mask != 0 && SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+    }
+
+#else
+
+    std::vector<std::vector<int>> physical_cores() {
+        return std::vector<std::vector<int>>();
+    }
+
+    bool set_current_thread_affinity(const std::vector<int>& /*cpus*/) {
+        return false;
+    }
+
+#endif
+
+}  // namespace util
+}  // namespace NUClear
@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_CPU_AFFINITY_HPP
+#define NUCLEAR_UTIL_CPU_AFFINITY_HPP
+
+#include <vector>
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * @brief Finds the physical cores on this machine and the logical cpus that belong to each of them.
+     *
+     * @details
+     *  On Linux this reads the cpu topology from /sys/devices/system/cpu. Logical cpus that are offline are ignored.
+     *  On platforms where the topology can't be read this returns an empty list.
+     *
+     * @return a list of the physical cores, each holding the ids of its logical cpus in ascending order
+     */
+    std::vector<std::vector<int>> physical_cores();
+
+    /**
+     * @brief Restricts the calling thread so that it only runs on the given logical cpus.
+     *
+     * @param cpus the ids of the logical cpus that the thread may run on
+     *
+     * @return true if the affinity was set, false if the platform doesn't support it or refused the request
+     */
+    bool set_current_thread_affinity(const std::vector<int>& cpus);
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_CPU_AFFINITY_HPP
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+struct Fanout {};
+
+constexpr int n_subscribers = 40;
+
+std::atomic<int> completed(0);
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        // All of these reactions are submitted to the thread pool together when Fanout is emitted
+        for (int i = 0; i < n_subscribers; ++i) {
+            on<Trigger<Fanout>>().then([this] {
+                if (++completed == n_subscribers) { powerplant.shutdown(); }
+            });
+        }
+
+        on<Startup>().then([this] { emit(std::make_unique<Fanout>()); });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that every reaction to an emit runs when they are submitted as a batch", "[api][batch]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 4;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(completed == n_subscribers);
+}
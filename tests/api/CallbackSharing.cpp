@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+struct Message {
+    Message(int value) : value(value) {}
+    int value;
+};
+
+struct Done {};
+
+int copies        = 0;
+int copies_at_run = -1;
+int calls         = 0;
+
+// A callback that counts how many times it is copied
+struct CountingCallback {
+    CountingCallback()                        = default;
+    CountingCallback(CountingCallback&&)      = default;
+    CountingCallback(const CountingCallback&) { ++copies; }
+
+    void operator()(const Message& message) const {
+        ++calls;
+        if (message.value == 9) { copies_at_run = copies; }
+    }
+};
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Message>>().then(CountingCallback());
+
+        on<Trigger<Done>>().then([this] { powerplant.shutdown(); });
+
+        on<Startup>().then([this] {
+            for (int i = 0; i < 10; ++i) {
+                emit(std::make_unique<Message>(i));
+            }
+            emit(std::make_unique<Done>());
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that tasks share their reaction's callback instead of copying it", "[api][callback]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    int copies_after_bind = copies;
+
+    plant.start();
+
+    REQUIRE(calls == 10);
+    REQUIRE(copies_at_run == copies_after_bind);
+}
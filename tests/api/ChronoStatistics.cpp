@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+namespace {
+
+NUClear::message::ChronoStatistics statistics;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Every<1, std::chrono::milliseconds>>().then([] {});
+
+        on<Trigger<NUClear::message::ChronoStatistics>>().then(
+            [this](const NUClear::message::ChronoStatistics& stats) {
+                statistics = stats;
+                powerplant.shutdown();
+            });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that the chrono controller reports how accurately it runs timers", "[api][chrono][statistics]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    // The statistics cover at least a second of a millisecond timer
+    REQUIRE(statistics.period >= std::chrono::seconds(1));
+    REQUIRE(statistics.dispatched > 0);
+
+    // Timers are never run early, and we only wake up early by a positive amount
+    REQUIRE(statistics.mean_lateness >= NUClear::clock::duration::zero());
+    REQUIRE(statistics.max_lateness >= statistics.mean_lateness);
+    REQUIRE(statistics.wake_lateness >= NUClear::clock::duration::zero());
+    REQUIRE(statistics.wake_offset >= NUClear::clock::duration::zero());
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+struct Start {};
+struct Older {};
+struct Continuation {};
+struct Urgent {};
+struct Final {};
+
+std::vector<std::string> order;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        // Continuation goes in the slot, so it runs before Older even though Older was queued first
+        on<Trigger<Start>>().then([this] {
+            order.push_back("start");
+            emit(std::make_unique<Continuation>());
+        });
+
+        on<Trigger<Continuation>>().then([] { order.push_back("continuation"); });
+
+        // Final goes in the slot, but Urgent is more important so it has to run first
+        on<Trigger<Older>>().then([this] {
+            order.push_back("older");
+            emit(std::make_unique<Final>());
+            emit(std::make_unique<Urgent>());
+        });
+
+        on<Trigger<Urgent>, Priority::HIGH>().then([] { order.push_back("urgent"); });
+
+        on<Trigger<Final>>().then([this] {
+            order.push_back("final");
+            powerplant.shutdown();
+        });
+
+        on<Startup>().then([this] {
+            emit(std::make_unique<Start>());
+            emit(std::make_unique<Older>());
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that a pool thread runs the first task it submits next unless something is more important",
+          "[api][continuation]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count      = 1;
+    config.continuation_slot = true;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(order == std::vector<std::string>({"start", "continuation", "older", "urgent", "final"}));
+}
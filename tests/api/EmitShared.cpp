@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+struct Value {
+    Value(int value) : value(value) {}
+    int value;
+};
+
+struct Forwarded {
+    Forwarded(int value) : value(value) {}
+    int value;
+};
+
+std::vector<int> values;
+std::vector<const Forwarded*> forwarded;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Value>>().then([](const Value& v) { values.push_back(v.value); });
+
+        // Forward the message we were given, the same message should come back to us rather than a copy
+        on<Trigger<Forwarded>>().then([this](const std::shared_ptr<const Forwarded>& f) {
+            forwarded.push_back(f.get());
+            if (forwarded.size() == 1) { emit<Scope::DIRECT>(f); }
+        });
+
+        on<Startup>().then([this] {
+            // A value
+            emit(Value(1));
+
+            // A shared_ptr to const data
+            emit<Scope::DIRECT>(std::shared_ptr<const Value>(std::make_shared<Value>(2)));
+
+            // A message made in place
+            emit<Scope::DIRECT>(NUClear::make_message<Value>(3));
+
+            emit<Scope::DIRECT>(NUClear::make_message<Forwarded>(4));
+        });
+
+        on<Trigger<Value>>().then([this](const Value& v) {
+            if (v.value == 1) { powerplant.shutdown(); }
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing emitting values and shared pointers", "[api][emit][shared]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    // The local emit runs after the direct ones
+    REQUIRE(values == std::vector<int>({2, 3, 1}));
+    REQUIRE(forwarded.size() == 2);
+    REQUIRE(forwarded[0] == forwarded[1]);
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+struct Ping {
+    Ping(int value) : value(value) {}
+    int value;
+};
+
+constexpr int n_pings = 1000;
+
+std::atomic<int> received(0);
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        // Each ping is emitted by the previous one so the other threads are always idle when it arrives
+        on<Trigger<Ping>>().then([this](const Ping& ping) {
+            ++received;
+            if (ping.value + 1 < n_pings) { emit(std::make_unique<Ping>(ping.value + 1)); }
+            else {
+                powerplant.shutdown();
+            }
+        });
+
+        on<Startup>().then([this] { emit(std::make_unique<Ping>(0)); });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that idle threads that spin before sleeping still receive every task", "[api][idle]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 4;
+    config.spin_count   = 1000;
+    config.yield_count  = 100;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(received == n_pings);
+}
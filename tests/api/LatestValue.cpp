@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+struct Value {
+    Value(int value) : value(value) {}
+    int value;
+};
+
+struct Writer {};
+struct Reader {};
+
+std::atomic<bool> writing(true);
+bool went_backwards = false;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Writer>>().then([this] {
+            for (int i = 1; i <= 20000; ++i) {
+                emit<Scope::DIRECT>(std::make_unique<Value>(i));
+            }
+            writing = false;
+        });
+
+        // Read the latest value while it is being replaced, it should never go back to an older one
+        on<Trigger<Reader>>().then([this] {
+            int last = 0;
+            while (writing) {
+                auto latest = NUClear::dsl::store::DataStore<Value>::get();
+                if (latest) {
+                    went_backwards |= latest->value < last;
+                    last = latest->value;
+                }
+            }
+            powerplant.shutdown();
+        });
+
+        on<Startup>().then([this] {
+            emit(std::make_unique<Writer>());
+            emit(std::make_unique<Reader>());
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing the latest value of a type can be read while it is being emitted", "[api][datastore]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 2;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE_FALSE(went_backwards);
+    REQUIRE(NUClear::dsl::store::DataStore<Value>::get()->value == 20000);
+}
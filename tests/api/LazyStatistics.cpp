@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+template <int id>
+struct Step {};
+
+using NUClear::message::LogMessage;
+using NUClear::message::ReactionStatistics;
+using NUClear::threading::ReactionTask;
+
+std::string logged_from;
+bool second_had_stats = false;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<LogMessage>>().then([](const LogMessage& message) {
+            // Even without statistics a log message should say which reaction made it
+            if (message.task != nullptr) { logged_from = message.task->identifier->name; }
+        });
+
+        on<Trigger<Step<1>>>().then("First", [this] {
+            // Nothing is listening for statistics yet so none should have been collected
+            REQUIRE(ReactionTask::get_current_task()->stats == nullptr);
+
+            log<NUClear::INFO>("Logging without statistics");
+
+            // Now start listening to statistics, the next task should collect them
+            on<Trigger<ReactionStatistics>>().then([this](const ReactionStatistics& stats) {
+                if (stats.identifier->name == "Second") {
+                    REQUIRE(stats.finished >= stats.started);
+
+                    // The type names are only demangled when we ask for them
+                    REQUIRE(stats.identifier->dsl().find("Step<2>") != std::string::npos);
+                    powerplant.shutdown();
+                }
+            });
+
+            emit(std::make_unique<Step<2>>());
+        });
+
+        on<Trigger<Step<2>>>().then("Second", [] {
+            // Statistics should be collected again now someone is listening
+            second_had_stats = ReactionTask::get_current_task()->stats != nullptr;
+        });
+
+        on<Startup>().then([this] { emit(std::make_unique<Step<1>>()); });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing reaction statistics are only collected when something listens for them", "[api][statistics]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor, NUClear::INFO>();
+
+    plant.start();
+
+    REQUIRE(logged_from == "First");
+    REQUIRE(second_had_stats);
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+struct Frame {
+    std::vector<uint8_t> data;
+};
+
+int frames                = 0;
+const Frame* first_frame  = nullptr;
+const Frame* reused_frame = nullptr;
+size_t reused_capacity    = 0;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Frame>>().then([](const Frame&) { ++frames; });
+
+        on<Startup>().then([this] {
+            auto first = NUClear::MessagePool<Frame>::acquire();
+            first->data.resize(1000);
+            first_frame = first.get();
+            emit<Scope::DIRECT>(first);
+            first.reset();
+
+            // The DataStore is still holding the first frame so this one has to be new
+            emit<Scope::DIRECT>(NUClear::MessagePool<Frame>::acquire());
+
+            // Now the DataStore has let go of the first frame it should be waiting to be reused
+            REQUIRE(NUClear::MessagePool<Frame>::occupancy() == 1);
+
+            auto reused     = NUClear::MessagePool<Frame>::acquire();
+            reused_frame    = reused.get();
+            reused_capacity = reused->data.capacity();
+
+            powerplant.shutdown();
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing messages are reused from a message pool", "[api][messagepool]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(frames == 2);
+    REQUIRE(reused_frame == first_frame);
+    REQUIRE(reused_capacity >= 1000);
+    REQUIRE(NUClear::MessagePool<Frame>::hits() == 1);
+    REQUIRE(NUClear::MessagePool<Frame>::misses() == 2);
+}
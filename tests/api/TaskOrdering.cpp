@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <numeric>
+
+#include <nuclear>
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+struct Normal {
+    Normal(int value) : value(value) {}
+    int value;
+};
+struct Urgent {};
+
+// More than a priority bucket can hold so some of the tasks have to spill over
+constexpr int n_normal = 3000;
+
+std::vector<int> order;
+bool urgent_ran   = false;
+bool urgent_first = false;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Urgent>, Priority::HIGH>().then([] {
+            urgent_ran   = true;
+            urgent_first = order.empty();
+        });
+
+        on<Trigger<Normal>>().then([this](const Normal& n) {
+            order.push_back(n.value);
+            if (order.size() == n_normal) { powerplant.shutdown(); }
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that tasks of the same priority run in the order they were emitted", "[api][taskordering]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    for (int i = 0; i < n_normal; ++i) {
+        plant.emit(std::make_unique<Normal>(i));
+    }
+    plant.emit(std::make_unique<Urgent>());
+
+    plant.start();
+
+    // The high priority task should jump the whole queue
+    REQUIRE(urgent_ran);
+    REQUIRE(urgent_first);
+
+    // Everything else should have run in order
+    std::vector<int> expected(n_normal);
+    std::iota(expected.begin(), expected.end(), 0);
+    REQUIRE(order == expected);
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+#ifdef __linux__
+#    include <sched.h>
+#endif
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+struct Work {};
+
+std::atomic<int> pool_cpu(-1);
+std::atomic<int> always_cpu(-1);
+
+/**
+ * @brief Gets the cpu the calling thread is running on, or 0 if we have no way of knowing
+ */
+int current_cpu() {
+#ifdef __linux__
+    return sched_getcpu();
+#else
+    return 0;
+#endif
+}
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Always>().then([this] {
+            if (always_cpu == -1) {
+                always_cpu = current_cpu();
+                emit(std::make_unique<Work>());
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        });
+
+        on<Trigger<Work>>().then([this] {
+            pool_cpu = current_cpu();
+            powerplant.shutdown();
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that pool threads and thread tasks run on the cpus they are pinned to", "[api][affinity]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count         = 2;
+    config.thread_affinity      = {{0}};
+    config.thread_task_affinity = {0};
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(always_cpu == 0);
+    REQUIRE(pool_cpu == 0);
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+// Windows can't do this test as it doesn't have file descriptors
+#ifndef _WIN32
+
+#include <unistd.h>
+
+#include <nuclear>
+
+namespace {
+
+constexpr int n_ticks = 10;
+
+int written  = 0;
+int received = 0;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)), in(0), out(0) {
+
+        int fds[2];
+
+        if (pipe(static_cast<int*>(fds)) < 0) { FAIL("We couldn't make the pipe for the test"); }
+
+        in  = fds[0];
+        out = fds[1];
+
+        // Each tick of our timer writes to the pipe, so the timer and the IO take turns waking the event loop
+        on<Every<5, std::chrono::milliseconds>>().then([this] {
+            if (written < n_ticks) {
+                unsigned char val = 0xDE;
+                if (::write(out, &val, 1) == 1) { ++written; }
+            }
+        });
+
+        on<IO>(in, IO::READ).then([this](const IO::Event& e) {
+            unsigned char val;
+            if (::read(e.fd, &val, 1) == 1 && val == 0xDE) { ++received; }
+
+            if (received == n_ticks) { powerplant.shutdown(); }
+        });
+    }
+
+    ~TestReactor() {
+        close(in);
+        close(out);
+    }
+
+    int in;
+    int out;
+};
+}  // namespace
+
+TEST_CASE("Testing that timers and IO run alongside each other", "[api][io][chrono]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(written == n_ticks);
+    REQUIRE(received == n_ticks);
+}
+
+#endif
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+struct Fanout {};
+
+struct Work {
+    Work(int value) : value(value) {}
+    int value;
+};
+
+constexpr int n_tasks = 100;
+
+std::mutex thread_mutex;
+std::set<std::thread::id> threads;
+std::atomic<int> completed(0);
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        // These emits come from a pool thread so they will all go onto that thread's own queue
+        on<Trigger<Fanout>>().then([this] {
+            for (int i = 0; i < n_tasks; ++i) {
+                emit(std::make_unique<Work>(i));
+            }
+        });
+
+        on<Trigger<Work>>().then([this](const Work&) {
+            /* Mutex Scope */ {
+                std::lock_guard<std::mutex> lock(thread_mutex);
+                threads.insert(std::this_thread::get_id());
+            }
+
+            // Take long enough that the idle threads will come looking for work
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+            if (++completed == n_tasks) { powerplant.shutdown(); }
+        });
+
+        on<Startup>().then([this] { emit(std::make_unique<Fanout>()); });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that idle threads steal work from a busy thread", "[api][workstealing]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count  = 4;
+    config.work_stealing = true;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    // Every task should have run and more than one thread should have run them
+    REQUIRE(completed == n_tasks);
+    REQUIRE(threads.size() > 1);
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+namespace {
+
+struct Data {
+    Data(int value) : value(value) {}
+    int value;
+};
+
+struct Finish {};
+
+std::vector<std::vector<int>> full;
+std::vector<std::vector<int>> timed;
+
+std::vector<int> values(const std::vector<std::shared_ptr<const Data>>& batch) {
+    std::vector<int> out;
+    for (const auto& d : batch) {
+        out.push_back(d->value);
+    }
+    return out;
+}
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        // Without a timeout the last two emissions never make a full batch
+        on<Batch<4, Data>>().then([](const std::vector<std::shared_ptr<const Data>>& batch) {
+            full.push_back(values(batch));
+        });
+
+        // With a timeout the last two emissions run once it expires
+        on<Batch<4, Data, 50, std::chrono::milliseconds>>().then(
+            [this](const std::vector<std::shared_ptr<const Data>>& batch) {
+                timed.push_back(values(batch));
+                if (batch.size() < 4) { emit(std::make_unique<Finish>()); }
+            });
+
+        on<Trigger<Finish>>().then([this] { powerplant.shutdown(); });
+
+        on<Startup>().then([this] {
+            for (int i = 0; i < 10; ++i) {
+                emit(std::make_unique<Data>(i));
+            }
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that batches run once full or once their timeout expires", "[api][dsl][batch]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(full == std::vector<std::vector<int>>({{0, 1, 2, 3}, {4, 5, 6, 7}}));
+    REQUIRE(timed == std::vector<std::vector<int>>({{0, 1, 2, 3}, {4, 5, 6, 7}, {8, 9}}));
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+namespace {
+
+struct Data {
+    Data(int value) : value(value) {}
+    int value;
+};
+
+struct Finish {};
+
+std::vector<int> coalesced;
+std::vector<int> every;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        // Nothing can run until the pool starts, so everything emitted during startup folds into the first task
+        on<Trigger<Data>, Coalesce>().then([this](const Data& d) {
+            coalesced.push_back(d.value);
+
+            // Once the first task is running, new data needs a new task again which the rest of this data folds into
+            if (d.value == 4) {
+                for (int i = 5; i < 10; ++i) {
+                    emit(std::make_unique<Data>(i));
+                }
+                emit(std::make_unique<Finish>());
+            }
+        });
+
+        on<Trigger<Data>>().then([](const Data& d) { every.push_back(d.value); });
+
+        on<Trigger<Finish>, Priority::IDLE>().then([this] { powerplant.shutdown(); });
+
+        on<Startup>().then([this] {
+            for (int i = 0; i < 5; ++i) {
+                emit(std::make_unique<Data>(i));
+            }
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that emissions fold into a waiting task which runs with the latest data", "[api][dsl][coalesce]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    // The coalescing reaction only ran once for each burst, with the last data of that burst
+    REQUIRE(coalesced == std::vector<int>({4, 9}));
+
+    // A normal reaction still sees every emission
+    REQUIRE(every == std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
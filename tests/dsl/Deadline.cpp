@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+namespace {
+
+struct Housekeeping {};
+struct Relaxed {};
+struct Urgent {};
+
+std::vector<std::string> order;
+uint64_t urgent_missed   = 0;
+bool urgent_had_deadline = false;
+
+using NUClear::message::ReactionStatistics;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Housekeeping>>().then("Housekeeping", [this] {
+            order.push_back("housekeeping");
+            powerplant.shutdown();
+        });
+
+        on<Trigger<Relaxed>, Deadline<1, std::chrono::seconds>>().then("Relaxed", [] { order.push_back("relaxed"); });
+
+        // Take longer than our deadline allows so that we miss it
+        on<Trigger<Urgent>, Deadline<1, std::chrono::milliseconds>>().then("Urgent", [] {
+            order.push_back("urgent");
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        });
+
+        on<Trigger<ReactionStatistics>>().then([](const ReactionStatistics& stats) {
+            if (stats.identifier->name == "Urgent") {
+                urgent_had_deadline = stats.deadline == stats.emitted + std::chrono::milliseconds(1);
+                urgent_missed       = stats.missed_deadlines;
+            }
+        });
+
+        // Emitted in the reverse of the order they should run in
+        on<Startup>().then([this] {
+            emit(std::make_unique<Housekeeping>());
+            emit(std::make_unique<Relaxed>());
+            emit(std::make_unique<Urgent>());
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that tasks with deadlines run earliest deadline first", "[api][dsl][deadline]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(order == std::vector<std::string>({"urgent", "relaxed", "housekeeping"}));
+    REQUIRE(urgent_had_deadline);
+    REQUIRE(urgent_missed == 1);
+}
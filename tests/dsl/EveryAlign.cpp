@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+NUClear::message::ChronoStatistics statistics;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        for (int i = 0; i < 5; ++i) {
+            on<Every<10, std::chrono::milliseconds>>().then([] {});
+        }
+
+        // This doesn't line up with the others, but with some slack it can wait for them
+        on<Every<15, std::chrono::milliseconds>>(std::chrono::milliseconds(5)).then([] {});
+
+        // Bind some more out of phase with the first ones, they should still line up with them
+        on<Startup>().then([this] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(3));
+            for (int i = 0; i < 5; ++i) {
+                on<Every<10, std::chrono::milliseconds>>().then([] {});
+            }
+        });
+
+        on<Trigger<NUClear::message::ChronoStatistics>>().then(
+            [this](const NUClear::message::ChronoStatistics& stats) {
+                statistics = stats;
+                powerplant.shutdown();
+            });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that Every reactions with commensurate periods run together", "[api][every][align]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    // Each 30ms has three wake-ups running thirty two timers, without phase alignment and slack there would be eight
+    REQUIRE(statistics.wakeups > 0);
+    REQUIRE(statistics.dispatched >= 8 * statistics.wakeups);
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <array>
+#include <catch.hpp>
+#include <nuclear>
+
+namespace {
+
+constexpr size_t n_timers = 100;
+
+std::array<int, n_timers> counts;
+std::array<int, n_timers> counts_at_unbind;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        counts.fill(0);
+
+        for (size_t i = 0; i < n_timers; ++i) {
+            handles.push_back(on<Every<5, std::chrono::milliseconds>>().then([i] { ++counts[i]; }));
+        }
+
+        on<Every<5, std::chrono::milliseconds>>().then([this] {
+            ++ticks;
+
+            // Unbind every second timer, the others should keep going
+            if (ticks == 5) {
+                counts_at_unbind = counts;
+                for (size_t i = 0; i < n_timers; i += 2) {
+                    handles[i].unbind();
+                }
+            }
+            else if (ticks == 15) {
+                powerplant.shutdown();
+            }
+        });
+    }
+
+private:
+    std::vector<NUClear::threading::ReactionHandle> handles;
+    int ticks = 0;
+};
+}  // namespace
+
+TEST_CASE("Testing that unbinding some of many timers stops only those timers", "[api][dsl][every][unbind]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    for (size_t i = 0; i < n_timers; ++i) {
+        if (i % 2 == 0) {
+            // A task made before the unbind may still have been waiting to run
+            REQUIRE(counts[i] - counts_at_unbind[i] <= 1);
+        }
+        else {
+            REQUIRE(counts[i] - counts_at_unbind[i] >= 5);
+        }
+    }
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+namespace {
+
+struct Data {
+    Data(int value) : value(value) {}
+    int value;
+};
+
+struct Finish {};
+
+constexpr int n_data = 5;
+
+std::vector<int> newest;
+std::vector<int> oldest;
+std::vector<int> blocked;
+uint64_t newest_occupancy = 0;
+uint64_t newest_dropped   = 0;
+
+using NUClear::message::ReactionStatistics;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        // Nothing can run until the pool starts, so each of these mailboxes fills up during startup
+        on<Trigger<Data>, Mailbox<2>::DROP_NEWEST>().then("Newest", [](const Data& d) { newest.push_back(d.value); });
+
+        on<Trigger<Data>, Mailbox<2>::DROP_OLDEST>().then("Oldest", [](const Data& d) { oldest.push_back(d.value); });
+
+        on<Trigger<Data>, Mailbox<2>::BLOCK<1, std::chrono::milliseconds>>().then(
+            "Block", [](const Data& d) { blocked.push_back(d.value); });
+
+        on<Trigger<ReactionStatistics>>().then([](const ReactionStatistics& stats) {
+            if (stats.identifier->name == "Newest" && newest_occupancy == 0) {
+                newest_occupancy = stats.mailbox_occupancy;
+                newest_dropped   = stats.mailbox_dropped;
+            }
+        });
+
+        on<Trigger<Finish>, Priority::IDLE>().then([this] { powerplant.shutdown(); });
+
+        on<Startup>().then([this] {
+            for (int i = 0; i < n_data; ++i) {
+                emit(std::make_unique<Data>(i));
+            }
+            emit(std::make_unique<Finish>());
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that a full mailbox handles new tasks using its policy", "[api][dsl][mailbox]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    // Dropping the newest keeps the first data, dropping the oldest keeps the last data in order
+    REQUIRE(newest == std::vector<int>({0, 1}));
+    REQUIRE(oldest == std::vector<int>({3, 4}));
+
+    // Blocking gives up after the timeout as there is nothing to run the tasks yet
+    REQUIRE(blocked == std::vector<int>({0, 1}));
+
+    // When the first task started the other one was still waiting, and the last three had been dropped
+    REQUIRE(newest_occupancy == 1);
+    REQUIRE(newest_dropped == n_data - 2);
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+#include <nuclear>
+
+namespace {
+
+struct SlowPool {
+    static constexpr int thread_count = 1;
+};
+
+struct Message {
+    Message(int value) : value(value) {}
+    int value;
+};
+
+constexpr int n_messages = 10;
+
+std::mutex thread_mutex;
+std::set<std::thread::id> default_threads;
+std::set<std::thread::id> pool_threads;
+std::atomic<int> default_count(0);
+std::atomic<int> pool_count(0);
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        // Run a task without Pool so we know which threads belong to the default pool
+        on<Trigger<Message>>().then([] {
+            std::lock_guard<std::mutex> lock(thread_mutex);
+            default_threads.insert(std::this_thread::get_id());
+            ++default_count;
+        });
+
+        // Run a task with Pool and make sure it only uses the pool's thread
+        on<Trigger<Message>, Pool<SlowPool>>().then([this] {
+            /* Mutex Scope */ {
+                std::lock_guard<std::mutex> lock(thread_mutex);
+                pool_threads.insert(std::this_thread::get_id());
+            }
+
+            if (++pool_count == n_messages) { powerplant.shutdown(); }
+        });
+
+        on<Startup>().then([this] {
+            for (int i = 0; i < n_messages; ++i) {
+                emit(std::make_unique<Message>(i));
+            }
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that the Pool keyword runs tasks on a separate thread pool", "[api][dsl][pool]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 2;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(pool_count == n_messages);
+
+    // Every pool task ran on the pool's single thread, which is not one of the default pool's threads
+    REQUIRE(pool_threads.size() == 1);
+    REQUIRE(default_threads.count(*pool_threads.begin()) == 0);
+    REQUIRE(pool_threads.count(NUClear::util::main_thread_id) == 0);
+}